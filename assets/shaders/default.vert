@@ -7,6 +7,7 @@ layout(location = 2) in vec2 aTexCoord;
 uniform mat4 uProjection;
 uniform mat4 uView;
 uniform mat4 uModel;
+uniform mat3 uNormalMatrix;
 
 out vec3 vNormal;
 out vec3 vFragPos;
@@ -17,6 +18,6 @@ void main() {
     gl_Position = uProjection * uView * worldPos;
     
     vFragPos = worldPos.xyz;
-    vNormal = mat3(transpose(inverse(uModel))) * aNormal;
+    vNormal = uNormalMatrix * aNormal;
     vTexCoord = aTexCoord;
 }
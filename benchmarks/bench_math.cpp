@@ -0,0 +1,354 @@
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdlib>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include <string>
+#include <vector>
+#include "Math3D/MathUtils.h"
+#include "Math3D/Matrix4.h"
+#include "Math3D/Quaternion.h"
+#include "Math3D/SIMD.h"
+#include "Math3D/Vector3.h"
+
+using namespace Math3D;
+using Clock = std::chrono::steady_clock;
+
+namespace {
+
+const size_t DATA_SIZE = 1024;
+
+volatile float g_sink = 0.0f;
+
+void Consume(float value) { g_sink = value; }
+void Consume(const Vector3& value) { g_sink = value.x + value.y + value.z; }
+void Consume(const Matrix4& value) { g_sink = value(0, 0) + value(1, 2) + value(2, 3) + value(3, 3); }
+
+struct Options {
+    int repetitions = 15;
+    double warmupMs = 50.0;
+    double minSampleMs = 5.0;
+    bool json = false;
+    std::string output;
+    std::string filter;
+};
+
+struct Result {
+    std::string name;
+    size_t opsPerIteration = 0;
+    size_t iterations = 0;
+    double minNs = 0.0;
+    double medianNs = 0.0;
+    double meanNs = 0.0;
+    double maxNs = 0.0;
+    double stddevNs = 0.0;
+    double opsPerSecond = 0.0;
+};
+
+double ElapsedMs(Clock::time_point start) {
+    return std::chrono::duration<double, std::milli>(Clock::now() - start).count();
+}
+
+template <typename Fn>
+size_t Calibrate(Fn& fn, const Options& options) {
+    Clock::time_point warmupStart = Clock::now();
+    while (ElapsedMs(warmupStart) < options.warmupMs) {
+        fn();
+    }
+
+    size_t iterations = 1;
+    for (;;) {
+        Clock::time_point start = Clock::now();
+        for (size_t i = 0; i < iterations; ++i) {
+            fn();
+        }
+        double elapsed = ElapsedMs(start);
+        if (elapsed >= options.minSampleMs || iterations >= (size_t(1) << 30)) {
+            return iterations;
+        }
+        double scale = elapsed > 0.0 ? options.minSampleMs / elapsed : 16.0;
+        iterations = static_cast<size_t>(static_cast<double>(iterations) * std::min(std::max(scale * 1.2, 2.0), 16.0));
+    }
+}
+
+template <typename Fn>
+Result Run(const std::string& name, size_t opsPerIteration, Fn fn, const Options& options) {
+    Result result;
+    result.name = name;
+    result.opsPerIteration = opsPerIteration;
+    result.iterations = Calibrate(fn, options);
+
+    std::vector<double> samples;
+    samples.reserve(options.repetitions);
+    for (int rep = 0; rep < options.repetitions; ++rep) {
+        Clock::time_point start = Clock::now();
+        for (size_t i = 0; i < result.iterations; ++i) {
+            fn();
+        }
+        double elapsedNs = std::chrono::duration<double, std::nano>(Clock::now() - start).count();
+        samples.push_back(elapsedNs / static_cast<double>(result.iterations * opsPerIteration));
+    }
+
+    std::sort(samples.begin(), samples.end());
+    double sum = 0.0;
+    for (double sample : samples) {
+        sum += sample;
+    }
+    result.minNs = samples.front();
+    result.maxNs = samples.back();
+    result.meanNs = sum / static_cast<double>(samples.size());
+    size_t middle = samples.size() / 2;
+    result.medianNs = samples.size() % 2 ? samples[middle] : (samples[middle - 1] + samples[middle]) * 0.5;
+
+    double variance = 0.0;
+    for (double sample : samples) {
+        variance += (sample - result.meanNs) * (sample - result.meanNs);
+    }
+    result.stddevNs = samples.size() > 1 ? std::sqrt(variance / static_cast<double>(samples.size() - 1)) : 0.0;
+    result.opsPerSecond = result.medianNs > 0.0 ? 1e9 / result.medianNs : 0.0;
+    return result;
+}
+
+std::string EscapeJson(const std::string& text) {
+    std::string escaped;
+    for (char c : text) {
+        if (c == '"' || c == '\\') {
+            escaped += '\\';
+        }
+        escaped += c;
+    }
+    return escaped;
+}
+
+void WriteJson(std::ostream& out, const std::vector<Result>& results, const Options& options) {
+    out << std::setprecision(6);
+    out << "{\n";
+    out << "  \"simd\": \"" << SIMD::GetLevelName(SIMD::GetLevel()) << "\",\n";
+    out << "  \"repetitions\": " << options.repetitions << ",\n";
+    out << "  \"benchmarks\": [\n";
+    for (size_t i = 0; i < results.size(); ++i) {
+        const Result& r = results[i];
+        out << "    {\"name\": \"" << EscapeJson(r.name) << "\", "
+            << "\"ops_per_iteration\": " << r.opsPerIteration << ", "
+            << "\"iterations\": " << r.iterations << ", "
+            << "\"ns_per_op\": {\"min\": " << r.minNs << ", \"median\": " << r.medianNs
+            << ", \"mean\": " << r.meanNs << ", \"max\": " << r.maxNs << ", \"stddev\": " << r.stddevNs << "}, "
+            << "\"ops_per_second\": " << r.opsPerSecond << "}"
+            << (i + 1 < results.size() ? "," : "") << "\n";
+    }
+    out << "  ]\n";
+    out << "}\n";
+}
+
+void WriteTable(std::ostream& out, const std::vector<Result>& results) {
+    out << std::left << std::setw(34) << "benchmark"
+        << std::right << std::setw(12) << "median ns" << std::setw(12) << "min ns"
+        << std::setw(12) << "stddev" << std::setw(16) << "Mops/s" << "\n";
+    out << std::string(86, '-') << "\n";
+    out << std::fixed << std::setprecision(3);
+    for (const Result& r : results) {
+        out << std::left << std::setw(34) << r.name
+            << std::right << std::setw(12) << r.medianNs << std::setw(12) << r.minNs
+            << std::setw(12) << r.stddevNs << std::setw(16) << r.opsPerSecond / 1e6 << "\n";
+    }
+}
+
+bool ParseOptions(int argc, char** argv, Options& options) {
+    for (int i = 1; i < argc; ++i) {
+        std::string arg = argv[i];
+        bool hasValue = i + 1 < argc;
+        if (arg == "--json") {
+            options.json = true;
+        } else if (arg == "--output" && hasValue) {
+            options.output = argv[++i];
+            options.json = true;
+        } else if (arg == "--filter" && hasValue) {
+            options.filter = argv[++i];
+        } else if (arg == "--repetitions" && hasValue) {
+            options.repetitions = std::max(1, std::atoi(argv[++i]));
+        } else if (arg == "--warmup-ms" && hasValue) {
+            options.warmupMs = std::max(0.0, std::atof(argv[++i]));
+        } else if (arg == "--min-sample-ms" && hasValue) {
+            options.minSampleMs = std::max(0.1, std::atof(argv[++i]));
+        } else {
+            std::cerr << "Usage: " << argv[0]
+                      << " [--json] [--output file.json] [--filter text] [--repetitions N]"
+                      << " [--warmup-ms ms] [--min-sample-ms ms]" << std::endl;
+            return false;
+        }
+    }
+    return true;
+}
+
+}
+
+int main(int argc, char** argv) {
+    Options options;
+    if (!ParseOptions(argc, argv, options)) {
+        return 1;
+    }
+
+    std::vector<Vector3> points(DATA_SIZE), directions(DATA_SIZE), transformed(DATA_SIZE);
+    std::vector<Vector3> translations(DATA_SIZE), angles(DATA_SIZE), scales(DATA_SIZE);
+    std::vector<Matrix4> affine(DATA_SIZE), projective(DATA_SIZE), results(DATA_SIZE);
+    std::vector<Quaternion> fromRotations(DATA_SIZE), toRotations(DATA_SIZE), blended(DATA_SIZE);
+    std::vector<float> weights(DATA_SIZE), sines(DATA_SIZE), cosines(DATA_SIZE);
+
+    Matrix4 projection = Matrix4::Perspective(MathUtils::Radians(60.0f), 16.0f / 9.0f, 0.1f, 100.0f);
+    for (size_t i = 0; i < DATA_SIZE; ++i) {
+        float t = static_cast<float>(i);
+        points[i] = Vector3(std::sin(t) * 10.0f, std::cos(t * 0.7f) * 5.0f, t * 0.01f - 5.0f);
+        directions[i] = Vector3(std::cos(t), 0.5f, std::sin(t * 1.3f)).Normalized();
+        translations[i] = points[i];
+        angles[i] = Vector3(std::sin(t * 0.3f), t * 0.013f, std::cos(t * 0.2f));
+        scales[i] = Vector3(1.0f + std::fmod(t * 0.1f, 1.0f), 1.0f, 2.0f);
+        affine[i] = Matrix4::FromTRS(translations[i], angles[i], scales[i]);
+        projective[i] = projection * affine[i];
+        fromRotations[i] = Quaternion::FromEuler(angles[i].x, angles[i].y, angles[i].z);
+        toRotations[i] = Quaternion::FromEuler(angles[i].z, -angles[i].x, angles[i].y * 3.0f);
+        weights[i] = std::fmod(t * 0.37f, 1.0f);
+    }
+    Matrix4 model = affine[17];
+
+    std::vector<Result> report;
+    auto bench = [&](const std::string& name, size_t ops, auto fn) {
+        if (!options.filter.empty() && name.find(options.filter) == std::string::npos) {
+            return;
+        }
+        report.push_back(Run(name, ops, fn, options));
+    };
+
+    bench("Vector3/Add", DATA_SIZE, [&]() {
+        Vector3 sum;
+        for (size_t i = 0; i < DATA_SIZE; ++i) {
+            sum += points[i] + directions[i];
+        }
+        Consume(sum);
+    });
+    bench("Vector3/Dot", DATA_SIZE, [&]() {
+        float sum = 0.0f;
+        for (size_t i = 0; i < DATA_SIZE; ++i) {
+            sum += points[i].Dot(directions[i]);
+        }
+        Consume(sum);
+    });
+    bench("Vector3/Cross", DATA_SIZE, [&]() {
+        Vector3 sum;
+        for (size_t i = 0; i < DATA_SIZE; ++i) {
+            sum += points[i].Cross(directions[i]);
+        }
+        Consume(sum);
+    });
+    bench("Vector3/Normalized", DATA_SIZE, [&]() {
+        Vector3 sum;
+        for (size_t i = 0; i < DATA_SIZE; ++i) {
+            sum += points[i].Normalized();
+        }
+        Consume(sum);
+    });
+
+    bench("Matrix4/Multiply", DATA_SIZE, [&]() {
+        for (size_t i = 0; i < DATA_SIZE; ++i) {
+            results[i] = projection * affine[i];
+        }
+        Consume(results[DATA_SIZE - 1]);
+    });
+    bench("Matrix4/Transposed", DATA_SIZE, [&]() {
+        for (size_t i = 0; i < DATA_SIZE; ++i) {
+            results[i] = projective[i].Transposed();
+        }
+        Consume(results[DATA_SIZE - 1]);
+    });
+    bench("Matrix4/Inverted/Affine", DATA_SIZE, [&]() {
+        for (size_t i = 0; i < DATA_SIZE; ++i) {
+            results[i] = affine[i].Inverted();
+        }
+        Consume(results[DATA_SIZE - 1]);
+    });
+    bench("Matrix4/Inverted/Projective", DATA_SIZE, [&]() {
+        for (size_t i = 0; i < DATA_SIZE; ++i) {
+            results[i] = projective[i].Inverted();
+        }
+        Consume(results[DATA_SIZE - 1]);
+    });
+    bench("Matrix4/InvertBatch/Projective", DATA_SIZE, [&]() {
+        Matrix4::InvertBatch(projective.data(), results.data(), DATA_SIZE);
+        Consume(results[DATA_SIZE - 1]);
+    });
+    bench("Matrix4/NormalMatrix", DATA_SIZE, [&]() {
+        float sum = 0.0f;
+        for (size_t i = 0; i < DATA_SIZE; ++i) {
+            sum += affine[i].NormalMatrix()(1, 1);
+        }
+        Consume(sum);
+    });
+    bench("Matrix4/LookAt", DATA_SIZE, [&]() {
+        for (size_t i = 0; i < DATA_SIZE; ++i) {
+            results[i] = Matrix4::LookAt(points[i], Vector3::Zero, Vector3::UnitY);
+        }
+        Consume(results[DATA_SIZE - 1]);
+    });
+    bench("Matrix4/Perspective", DATA_SIZE, [&]() {
+        for (size_t i = 0; i < DATA_SIZE; ++i) {
+            results[i] = Matrix4::Perspective(0.5f + weights[i], 1.5f, 0.1f, 100.0f);
+        }
+        Consume(results[DATA_SIZE - 1]);
+    });
+    bench("Matrix4/FromTRS/Chained", DATA_SIZE, [&]() {
+        for (size_t i = 0; i < DATA_SIZE; ++i) {
+            results[i] = Matrix4::Translation(translations[i]) * Matrix4::RotationY(angles[i].y) *
+                         Matrix4::RotationX(angles[i].x) * Matrix4::RotationZ(angles[i].z) * Matrix4::Scaling(scales[i]);
+        }
+        Consume(results[DATA_SIZE - 1]);
+    });
+    bench("Matrix4/FromTRSBatch/Euler", DATA_SIZE, [&]() {
+        Matrix4::FromTRSBatch(translations.data(), angles.data(), scales.data(), results.data(), DATA_SIZE);
+        Consume(results[DATA_SIZE - 1]);
+    });
+
+    bench("Transform/Point/Loop", DATA_SIZE, [&]() {
+        for (size_t i = 0; i < DATA_SIZE; ++i) {
+            transformed[i] = (model * Vector4(points[i], 1.0f)).XYZ();
+        }
+        Consume(transformed[DATA_SIZE - 1]);
+    });
+    bench("Transform/Points/Batch", DATA_SIZE, [&]() {
+        model.TransformPoints(points.data(), transformed.data(), DATA_SIZE);
+        Consume(transformed[DATA_SIZE - 1]);
+    });
+    bench("Transform/Directions/Batch", DATA_SIZE, [&]() {
+        model.TransformDirections(directions.data(), transformed.data(), DATA_SIZE);
+        Consume(transformed[DATA_SIZE - 1]);
+    });
+    bench("Transform/Projective/Batch", DATA_SIZE, [&]() {
+        projection.TransformPointsProjective(points.data(), transformed.data(), DATA_SIZE);
+        Consume(transformed[DATA_SIZE - 1]);
+    });
+
+    bench("Quaternion/SlerpBatch", DATA_SIZE, [&]() {
+        Quaternion::SlerpBatch(fromRotations.data(), toRotations.data(), weights.data(), blended.data(), DATA_SIZE);
+        Consume(blended[DATA_SIZE - 1].w);
+    });
+    bench("MathUtils/SinCosBatch", DATA_SIZE, [&]() {
+        MathUtils::SinCosBatch(weights.data(), sines.data(), cosines.data(), DATA_SIZE);
+        Consume(sines[DATA_SIZE - 1] + cosines[DATA_SIZE - 1]);
+    });
+
+    if (!options.output.empty()) {
+        std::ofstream file(options.output);
+        if (!file) {
+            std::cerr << "Failed to open " << options.output << std::endl;
+            return 1;
+        }
+        WriteJson(file, report, options);
+    } else if (options.json) {
+        WriteJson(std::cout, report, options);
+    } else {
+        std::cout << "Term3D Math3D benchmarks (" << SIMD::GetLevelName(SIMD::GetLevel()) << ", "
+                  << options.repetitions << " repetitions)" << std::endl;
+        WriteTable(std::cout, report);
+    }
+    return 0;
+}
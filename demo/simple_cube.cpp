@@ -1,6 +1,9 @@
 #include <iostream>
 #include <chrono>
+#include <cstring>
+#include <memory>
 #include "Core/GraphicsEngine.h"
+#include "Rendering/SoftwareRenderer.h"
 #include "Geometry/Mesh.h"
 #include "Math3D/MathUtils.h"
 
@@ -9,12 +12,17 @@ using namespace Geometry;
 using namespace Math3D;
 using Rendering::Color;
 
-int main() {
+int main(int argc, char** argv) {
+    bool software = argc > 1 && std::strcmp(argv[1], "--software") == 0;
+
     std::cout << "=== Term3D WORKING DEMO ===" << std::endl;
     std::cout << "Showing rotating 3D cube with simple transformations" << std::endl;
     
     GraphicsEngine engine;
-    if (!engine.Initialize(800, 600, "Term3D - Working Cube")) {
+    bool initialized = software
+        ? engine.Initialize(std::make_unique<Rendering::SoftwareRenderer>(), 800, 600, "Term3D - Working Cube")
+        : engine.Initialize(800, 600, "Term3D - Working Cube");
+    if (!initialized) {
         std::cerr << "Failed to initialize graphics engine!" << std::endl;
         return -1;
     }
@@ -0,0 +1,58 @@
+#include <iostream>
+#include <chrono>
+#include <cstring>
+#include "Rendering/TerminalRenderer.h"
+#include "Geometry/Mesh.h"
+#include "Math3D/MathUtils.h"
+
+using namespace Geometry;
+using namespace Math3D;
+using Rendering::Color;
+using Rendering::ClearFlags;
+using Rendering::RenderState;
+
+int main(int argc, char** argv) {
+    bool braille = argc > 1 && std::strcmp(argv[1], "--braille") == 0;
+
+    Rendering::TerminalRenderer renderer;
+    if (braille) {
+        renderer.SetOutputMode(Rendering::TerminalOutputMode::Braille);
+    }
+    if (!renderer.Initialize(0, 0, "Term3D - Terminal Sphere")) {
+        std::cerr << "Failed to initialize terminal renderer!" << std::endl;
+        return -1;
+    }
+
+    float aspect = static_cast<float>(renderer.GetWidth()) / renderer.GetHeight();
+    renderer.SetProjectionMatrix(Matrix4::Perspective(MathUtils::Radians(50.0f), aspect, 0.1f, 100.0f));
+    renderer.SetViewMatrix(Matrix4::LookAt(Vector3(0.0f, 1.5f, 4.0f), Vector3::Zero, Vector3::UnitY));
+    renderer.EnableState(RenderState::FaceCulling);
+    if (braille) {
+        renderer.EnableState(RenderState::Wireframe);
+    }
+    renderer.SetDrawColor(Color(0.9f, 0.6f, 0.2f));
+
+    Mesh sphere = Mesh::CreateSphere(1.2f, 24);
+
+    auto startTime = std::chrono::high_resolution_clock::now();
+    int frameCount = 0;
+    float time = 0.0f;
+
+    while (time < 10.0f) {
+        time = std::chrono::duration<float>(std::chrono::high_resolution_clock::now() - startTime).count();
+
+        Matrix4 model = Matrix4::RotationY(time) * Matrix4::RotationX(time * 0.7f);
+
+        renderer.BeginFrame();
+        renderer.Clear(ClearFlags::Color | ClearFlags::Depth, Color(0.05f, 0.05f, 0.1f));
+        renderer.DrawMesh(sphere, model);
+        renderer.EndFrame();
+        frameCount++;
+    }
+
+    int bytesWritten = renderer.GetBytesWritten();
+    renderer.Shutdown();
+    std::cout << "Average FPS: " << frameCount / time << std::endl;
+    std::cout << "Average bytes per frame: " << bytesWritten / frameCount << std::endl;
+    return 0;
+}
@@ -34,12 +34,11 @@ int main() {
         for (int i = 0; i < 5; i++) {
             float segmentTime = time * (0.8f + i * 0.2f);
             
-            Matrix4 translation = Matrix4::Translation(Vector3(1.2f, 0.0f, 0.0f));
-            Matrix4 rotation = Matrix4::RotationY(segmentTime) * 
-                              Matrix4::RotationZ(std::sin(segmentTime + i) * 0.5f);
-            Matrix4 scale = Matrix4::Scaling(Vector3(0.8f, 0.8f, 0.8f));
+            Matrix4 local = Matrix4::FromTRS(Vector3(1.2f, 0.0f, 0.0f),
+                                             Vector3(0.0f, segmentTime, std::sin(segmentTime + i) * 0.5f),
+                                             Vector3(0.8f, 0.8f, 0.8f));
             
-            baseTransform = baseTransform * translation * rotation * scale;
+            baseTransform = baseTransform * local;
             engine.DrawMesh(cube, baseTransform);
         }
         
@@ -1,5 +1,5 @@
 #pragma once
-#include "Rendering/OpenGLRenderer.h"
+#include "Rendering/IRenderer.h"
 #include "Geometry/Mesh.h"
 #include "Math3D/Matrix4.h"
 #include <memory>
@@ -8,13 +8,14 @@ namespace Core {
 
 class GraphicsEngine {
 private:
-    std::unique_ptr<Rendering::OpenGLRenderer> m_renderer;
+    std::unique_ptr<Rendering::IRenderer> m_renderer;
 
 public:
     GraphicsEngine();
     ~GraphicsEngine();
     
     bool Initialize(int width, int height, const char* title = "Term3D");
+    bool Initialize(std::unique_ptr<Rendering::IRenderer> renderer, int width, int height, const char* title = "Term3D");
     void Shutdown();
     
     void BeginFrame();
@@ -25,6 +26,7 @@ public:
     void DrawMesh(const Geometry::Mesh& mesh);
     
     bool ShouldClose() const;
+    Rendering::IRenderer* GetRenderer() const { return m_renderer.get(); }
 };
 
 }
@@ -0,0 +1,45 @@
+#pragma once
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace Core {
+
+class ThreadPool {
+private:
+    std::vector<std::thread> m_workers;
+    std::mutex m_dispatchMutex;
+    std::mutex m_mutex;
+    std::condition_variable m_wake;
+    std::condition_variable m_done;
+
+    const std::function<void(size_t)>* m_task = nullptr;
+    size_t m_taskCount = 0;
+    std::atomic<size_t> m_nextIndex{0};
+    size_t m_activeWorkers = 0;
+    uint64_t m_generation = 0;
+    bool m_stopping = false;
+
+    void WorkerLoop();
+    void RunTasks(const std::function<void(size_t)>& task, size_t count);
+
+public:
+    explicit ThreadPool(size_t threadCount = 0);
+    ~ThreadPool();
+
+    ThreadPool(const ThreadPool&) = delete;
+    ThreadPool& operator=(const ThreadPool&) = delete;
+
+    size_t GetThreadCount() const { return m_workers.size() + 1; }
+
+    void ParallelFor(size_t count, const std::function<void(size_t index)>& task);
+
+    static ThreadPool& Global();
+};
+
+}
@@ -0,0 +1,85 @@
+#pragma once
+#include "Geometry/BoundingBox.h"
+#include "Geometry/Mesh.h"
+#include "Geometry/Ray.h"
+#include "Math3D/Vector3.h"
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <vector>
+
+namespace Geometry {
+
+struct BVHNode {
+    float boundsMin[3];
+    uint32_t leftFirst;
+    float boundsMax[3];
+    uint32_t triangleCount;
+
+    bool IsLeaf() const { return triangleCount > 0; }
+};
+
+static_assert(sizeof(BVHNode) == 32, "BVHNode must stay 32 bytes");
+
+struct BVHTriangle {
+    Math3D::Vector3 v0;
+    Math3D::Vector3 edge1;
+    Math3D::Vector3 edge2;
+};
+
+struct RayHit {
+    static constexpr uint32_t NO_TRIANGLE = UINT32_MAX;
+
+    float distance = std::numeric_limits<float>::infinity();
+    uint32_t triangle = NO_TRIANGLE;
+    float u = 0.0f;
+    float v = 0.0f;
+
+    bool IsHit() const { return triangle != NO_TRIANGLE; }
+};
+
+struct BVHStatistics {
+    double buildMilliseconds = 0.0;
+    size_t nodeCount = 0;
+    size_t leafCount = 0;
+    size_t maxDepth = 0;
+    size_t maxLeafTriangles = 0;
+    size_t nodeMemory = 0;
+    size_t triangleMemory = 0;
+    float sahCost = 0.0f;
+
+    size_t GetTotalMemory() const { return nodeMemory + triangleMemory; }
+};
+
+class BVH {
+public:
+    static constexpr size_t BIN_COUNT = 16;
+    static constexpr size_t DEFAULT_MAX_LEAF_TRIANGLES = 4;
+    static constexpr size_t MAX_DEPTH = 64;
+    static constexpr float TRAVERSAL_COST = 1.0f;
+    static constexpr float INTERSECTION_COST = 1.0f;
+
+    BVH() = default;
+
+    static BVH Build(const Mesh& mesh, size_t maxLeafTriangles = DEFAULT_MAX_LEAF_TRIANGLES);
+
+    bool Intersect(const Ray& ray, RayHit& hit) const;
+    bool Occluded(const Ray& ray) const;
+
+    bool Empty() const { return m_nodes.empty(); }
+    BoundingBox GetBounds() const;
+    const std::vector<BVHNode>& GetNodes() const { return m_nodes; }
+    const std::vector<uint32_t>& GetTriangleIndices() const { return m_triangleIndices; }
+    const BVHStatistics& GetStatistics() const { return m_statistics; }
+
+private:
+    std::vector<BVHNode> m_nodes;
+    std::vector<BVHTriangle> m_triangles;
+    std::vector<uint32_t> m_triangleIndices;
+    BVHStatistics m_statistics;
+
+    template <bool AnyHit>
+    bool Traverse(const Ray& ray, RayHit& hit) const;
+};
+
+}
@@ -0,0 +1,46 @@
+#pragma once
+#include "Geometry/BoundingBox.h"
+#include "Math3D/Matrix4.h"
+#include "Math3D/Vector3.h"
+#include "Math3D/Vector4.h"
+#include <cstddef>
+#include <cstdint>
+
+namespace Geometry {
+
+enum class FrustumPlane {
+    Left,
+    Right,
+    Bottom,
+    Top,
+    Near,
+    Far
+};
+
+class Frustum {
+public:
+    static constexpr int PLANE_COUNT = 6;
+
+    Frustum();
+    explicit Frustum(const Math3D::Matrix4& viewProjection);
+
+    void Extract(const Math3D::Matrix4& viewProjection);
+    const Math3D::Vector4& GetPlane(FrustumPlane plane) const { return m_planes[static_cast<int>(plane)]; }
+
+    bool ContainsPoint(const Math3D::Vector3& point) const;
+    bool IntersectsSphere(const Math3D::Vector3& center, float radius) const;
+    bool IntersectsBox(const BoundingBox& box) const;
+
+    size_t CullBoxes(const BoundingBox* boxes, size_t count, uint32_t* visibility) const;
+    size_t CullSpheres(const Math3D::Vector3* centers, const float* radii, size_t count, uint32_t* visibility) const;
+
+    static size_t GetMaskWordCount(size_t count) { return (count + 31) / 32; }
+    static bool IsVisible(const uint32_t* visibility, size_t index) {
+        return (visibility[index / 32] >> (index % 32)) & 1u;
+    }
+
+private:
+    Math3D::Vector4 m_planes[PLANE_COUNT];
+};
+
+}
@@ -0,0 +1,50 @@
+#pragma once
+#include "Geometry/BoundingBox.h"
+#include "Geometry/Mesh.h"
+#include "Math3D/Matrix4.h"
+#include <cstddef>
+#include <vector>
+
+namespace Geometry {
+
+class LODGroup {
+public:
+    static constexpr float DEFAULT_ERROR_THRESHOLD = 1.0f;
+    static constexpr float DEFAULT_HYSTERESIS = 0.25f;
+
+    LODGroup() = default;
+    explicit LODGroup(std::vector<MeshLOD> levels);
+
+    static LODGroup Create(const Mesh& mesh, const std::vector<float>& ratios);
+
+    void AddLevel(const Mesh& mesh, float error);
+    void Clear();
+
+    bool Empty() const { return m_levels.empty(); }
+    size_t GetLevelCount() const { return m_levels.size(); }
+    const MeshLOD& GetLevel(size_t level) const { return m_levels[level]; }
+    const BoundingBox& GetBounds() const;
+
+    float GetErrorThreshold() const { return m_errorThreshold; }
+    void SetErrorThreshold(float pixels);
+    float GetHysteresis() const { return m_hysteresis; }
+    void SetHysteresis(float hysteresis);
+
+    size_t GetCurrentLevel() const { return m_currentLevel; }
+    const MeshLOD& GetCurrentMesh() const;
+    void ResetSelection() { m_currentLevel = 0; }
+
+    float GetProjectionScale(const Math3D::Matrix4& projection, const Math3D::Matrix4& modelView,
+                             float viewportHeight) const;
+    float GetScreenSpaceError(size_t level, const Math3D::Matrix4& projection, const Math3D::Matrix4& modelView,
+                              float viewportHeight) const;
+    size_t SelectLevel(const Math3D::Matrix4& projection, const Math3D::Matrix4& modelView, float viewportHeight);
+
+private:
+    std::vector<MeshLOD> m_levels;
+    float m_errorThreshold = DEFAULT_ERROR_THRESHOLD;
+    float m_hysteresis = DEFAULT_HYSTERESIS;
+    size_t m_currentLevel = 0;
+};
+
+}
@@ -1,15 +1,37 @@
 #pragma once
 #include "Geometry/Vertex.h"
+#include "Geometry/VertexStreams.h"
 #include "Geometry/BoundingBox.h"
 #include <vector>
 #include <cstdint>
+#include <limits>
 #include <memory>
 
 namespace Geometry {
 
+struct VertexCacheStatistics {
+    size_t verticesTransformed = 0;
+    float acmr = 0.0f;
+    float atvr = 0.0f;
+};
+
+struct OverdrawStatistics {
+    size_t pixelsCovered = 0;
+    size_t pixelsShaded = 0;
+    float overdraw = 0.0f;
+};
+
+struct MeshLOD;
+
 class Mesh {
 public:
+    static constexpr size_t DEFAULT_VERTEX_CACHE_SIZE = 16;
+    static constexpr float DEFAULT_OVERDRAW_THRESHOLD = 1.05f;
+    static constexpr float DEFAULT_WELD_EPSILON = 1e-5f;
+    static constexpr float DEFAULT_WELD_ATTRIBUTE_EPSILON = 1e-3f;
+    
     std::vector<Vertex> vertices;
+    VertexStreams streams;
     std::vector<uint32_t> indices;
     BoundingBox bounds;
     
@@ -22,16 +44,50 @@ public:
     void Clear();
     bool IsValid() const;
     
+    VertexLayout GetLayout() const { return m_layout; }
+    void SetLayout(VertexLayout layout);
+    Vertex GetVertex(size_t index) const;
+    Math3D::Vector3 GetPosition(size_t index) const;
+    void CopyVerticesTo(std::vector<Vertex>& out) const;
+    
     static Mesh CreateCube(float size = 1.0f);
     static Mesh CreatePlane(float size = 1.0f, uint32_t segments = 1);
     static Mesh CreateSphere(float radius = 1.0f, uint32_t segments = 16);
     static Mesh CreateCylinder(float radius = 0.5f, float height = 1.0f, uint32_t segments = 16);
     
-    size_t GetVertexCount() const { return vertices.size(); }
+    size_t GetVertexCount() const {
+        return m_layout == VertexLayout::Streams ? streams.Size() : vertices.size();
+    }
     size_t GetIndexCount() const { return indices.size(); }
     size_t GetTriangleCount() const { return indices.size() / 3; }
     
     void Transform(const Math3D::Matrix4& transform);
+    
+    void OptimizeVertexCache();
+    VertexCacheStatistics AnalyzeVertexCache(size_t cacheSize = DEFAULT_VERTEX_CACHE_SIZE) const;
+    void OptimizeOverdraw(float threshold = DEFAULT_OVERDRAW_THRESHOLD);
+    OverdrawStatistics AnalyzeOverdraw() const;
+    size_t OptimizeVertexFetch();
+    size_t WeldVertices(float epsilon = DEFAULT_WELD_EPSILON,
+                        VertexAttribute attributes = VertexAttribute::All,
+                        float attributeEpsilon = DEFAULT_WELD_ATTRIBUTE_EPSILON);
+    
+    float Simplify(size_t targetIndexCount, float maxError = std::numeric_limits<float>::max());
+    std::vector<MeshLOD> GenerateLODs(const std::vector<float>& ratios) const;
+
+private:
+    void CalculateStreamNormals();
+    void CalculateStreamTangents();
+    void TransformStreams(const Math3D::Matrix4& transform);
+    void RemapVertices(const std::vector<uint32_t>& remap, size_t vertexCount);
+
+    VertexLayout m_layout = VertexLayout::Interleaved;
+};
+
+struct MeshLOD {
+    Mesh mesh;
+    float ratio = 1.0f;
+    float error = 0.0f;
 };
 
-} 
+}
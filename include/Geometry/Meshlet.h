@@ -0,0 +1,59 @@
+#pragma once
+#include "Geometry/BoundingBox.h"
+#include "Geometry/Frustum.h"
+#include "Geometry/Mesh.h"
+#include "Math3D/Vector3.h"
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace Geometry {
+
+struct Meshlet {
+    uint32_t vertexOffset = 0;
+    uint32_t vertexCount = 0;
+    uint32_t triangleOffset = 0;
+    uint32_t triangleCount = 0;
+
+    BoundingBox bounds;
+    Math3D::Vector3 center;
+    float radius = 0.0f;
+
+    Math3D::Vector3 coneApex;
+    Math3D::Vector3 coneAxis;
+    float coneCutoff = 1.0f;
+
+    bool HasNormalCone() const { return coneCutoff < 1.0f; }
+    bool IsBackFacing(const Math3D::Vector3& cameraPosition) const;
+    bool IsVisible(const Frustum& frustum) const { return frustum.IntersectsSphere(center, radius); }
+};
+
+class MeshletMesh {
+public:
+    static constexpr size_t DEFAULT_MAX_VERTICES = 64;
+    static constexpr size_t DEFAULT_MAX_TRIANGLES = 124;
+    static constexpr size_t MAX_VERTICES_LIMIT = 256;
+
+    std::vector<Meshlet> meshlets;
+    std::vector<uint32_t> vertices;
+    std::vector<uint8_t> triangles;
+
+    MeshletMesh() = default;
+
+    static MeshletMesh Build(const Mesh& mesh, size_t maxVertices = DEFAULT_MAX_VERTICES,
+                             size_t maxTriangles = DEFAULT_MAX_TRIANGLES);
+
+    size_t Cull(const Frustum& frustum, const Math3D::Vector3* cameraPosition, std::vector<uint32_t>& visible) const;
+
+    bool Empty() const { return meshlets.empty(); }
+    size_t GetMeshletCount() const { return meshlets.size(); }
+    size_t GetTriangleCount() const { return triangles.size() / 3; }
+    size_t GetMaxVertices() const { return m_maxVertices; }
+    size_t GetMaxTriangles() const { return m_maxTriangles; }
+
+private:
+    size_t m_maxVertices = DEFAULT_MAX_VERTICES;
+    size_t m_maxTriangles = DEFAULT_MAX_TRIANGLES;
+};
+
+}
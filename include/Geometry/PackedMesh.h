@@ -0,0 +1,51 @@
+#pragma once
+#include "Geometry/BoundingBox.h"
+#include "Geometry/Mesh.h"
+#include "Geometry/Vertex.h"
+#include "Math3D/Matrix4.h"
+#include "Math3D/Vector3.h"
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace Geometry {
+
+struct PackedVertex {
+    uint16_t position[3];
+    int16_t bitangentSign;
+    int8_t normal[2];
+    int8_t tangent[2];
+    uint16_t texCoord[2];
+
+    static void EncodeDirection(const Math3D::Vector3& direction, int8_t out[2]);
+    static Math3D::Vector3 DecodeDirection(const int8_t in[2]);
+};
+
+static_assert(sizeof(PackedVertex) == 16, "PackedVertex must stay 16 bytes");
+
+class PackedMesh {
+public:
+    static constexpr float POSITION_LEVELS = 65535.0f;
+
+    std::vector<PackedVertex> vertices;
+    std::vector<uint32_t> indices;
+    BoundingBox bounds;
+
+    PackedMesh() = default;
+
+    static PackedMesh Encode(const Mesh& mesh);
+    Mesh Decode() const;
+
+    Vertex DecodeVertex(size_t index) const;
+    Math3D::Vector3 DecodePosition(size_t index) const;
+    Math3D::Vector3 GetPositionStep() const;
+    Math3D::Matrix4 GetDequantizationMatrix() const;
+
+    bool IsValid() const;
+    size_t GetVertexCount() const { return vertices.size(); }
+    size_t GetIndexCount() const { return indices.size(); }
+    size_t GetTriangleCount() const { return indices.size() / 3; }
+    size_t GetVertexMemory() const { return vertices.size() * sizeof(PackedVertex); }
+};
+
+}
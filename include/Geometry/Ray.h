@@ -0,0 +1,21 @@
+#pragma once
+#include "Math3D/Vector3.h"
+#include <limits>
+
+namespace Geometry {
+
+struct Ray {
+    Math3D::Vector3 origin;
+    Math3D::Vector3 direction;
+    float tMin = 0.0f;
+    float tMax = std::numeric_limits<float>::infinity();
+
+    Ray() = default;
+    Ray(const Math3D::Vector3& origin, const Math3D::Vector3& direction,
+        float tMin = 0.0f, float tMax = std::numeric_limits<float>::infinity())
+        : origin(origin), direction(direction), tMin(tMin), tMax(tMax) {}
+
+    Math3D::Vector3 At(float t) const { return origin + direction * t; }
+};
+
+}
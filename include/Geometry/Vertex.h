@@ -3,9 +3,34 @@
 #include "Math3D/Vector2.h"
 #include "Math3D/Matrix3.h"
 #include "Math3D/Matrix4.h"
+#include <type_traits>
 
 namespace Geometry {
 
+enum class VertexAttribute {
+    None = 0,
+    Position = 1 << 0,
+    Normal = 1 << 1,
+    Tangent = 1 << 2,
+    Bitangent = 1 << 3,
+    TexCoord = 1 << 4,
+    All = Position | Normal | Tangent | Bitangent | TexCoord
+};
+
+constexpr VertexAttribute operator|(VertexAttribute a, VertexAttribute b) {
+    using T = typename std::underlying_type<VertexAttribute>::type;
+    return static_cast<VertexAttribute>(static_cast<T>(a) | static_cast<T>(b));
+}
+
+constexpr VertexAttribute operator&(VertexAttribute a, VertexAttribute b) {
+    using T = typename std::underlying_type<VertexAttribute>::type;
+    return static_cast<VertexAttribute>(static_cast<T>(a) & static_cast<T>(b));
+}
+
+inline bool HasAttribute(VertexAttribute attributes, VertexAttribute attribute) {
+    return (attributes & attribute) != VertexAttribute::None;
+}
+
 struct Vertex {
     Math3D::Vector3 position;
     Math3D::Vector3 normal;
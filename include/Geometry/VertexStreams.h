@@ -0,0 +1,40 @@
+#pragma once
+#include "Geometry/Vertex.h"
+#include "Math3D/Vector2.h"
+#include "Math3D/Vector3Stream.h"
+#include <cstddef>
+#include <vector>
+
+namespace Geometry {
+
+enum class VertexLayout {
+    Interleaved,
+    Streams
+};
+
+class VertexStreams {
+public:
+    Math3D::Vector3Stream positions;
+    Math3D::Vector3Stream normals;
+    Math3D::Vector3Stream tangents;
+    Math3D::Vector3Stream bitangents;
+    std::vector<Math3D::Vector2> texCoords;
+
+    VertexStreams() = default;
+    VertexStreams(const Vertex* vertices, size_t count);
+
+    size_t Size() const { return positions.Size(); }
+    bool Empty() const { return positions.Empty(); }
+    void Resize(size_t count);
+    void Reserve(size_t count);
+    void Clear();
+
+    void PushBack(const Vertex& vertex);
+    Vertex Get(size_t index) const;
+    void Set(size_t index, const Vertex& vertex);
+
+    void Assign(const Vertex* vertices, size_t count);
+    void CopyTo(Vertex* out) const;
+};
+
+}
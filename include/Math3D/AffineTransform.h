@@ -0,0 +1,161 @@
+#pragma once
+#include "Math3D/Matrix3.h"
+#include "Math3D/Matrix4.h"
+#include "Math3D/Quaternion.h"
+#include "Math3D/Vector3.h"
+#include <cstddef>
+
+namespace Math3D {
+
+class AffineTransform {
+private:
+    float m[12];
+
+public:
+    constexpr AffineTransform() : m{ 1.0f, 0.0f, 0.0f, 0.0f, 1.0f, 0.0f, 0.0f, 0.0f, 1.0f, 0.0f, 0.0f, 0.0f } {}
+    constexpr AffineTransform(const AffineTransform& other) = default;
+    constexpr AffineTransform(const Matrix3& linear, const Vector3& translation) : m{} {
+        for (int col = 0; col < 3; ++col) {
+            for (int row = 0; row < 3; ++row) {
+                m[col * 3 + row] = linear(row, col);
+            }
+        }
+        m[9] = translation.x;
+        m[10] = translation.y;
+        m[11] = translation.z;
+    }
+    constexpr explicit AffineTransform(const Matrix4& matrix) : m{} {
+        for (int col = 0; col < 4; ++col) {
+            for (int row = 0; row < 3; ++row) {
+                m[col * 3 + row] = matrix(row, col);
+            }
+        }
+    }
+
+    constexpr AffineTransform& operator=(const AffineTransform& other) = default;
+
+    constexpr float& operator()(int row, int col) { return m[col * 3 + row]; }
+    constexpr float operator()(int row, int col) const { return m[col * 3 + row]; }
+    constexpr const float* Data() const { return m; }
+
+    constexpr Vector3 GetTranslation() const { return Vector3(m[9], m[10], m[11]); }
+    constexpr Matrix3 GetLinear() const {
+        Matrix3 result;
+        for (int col = 0; col < 3; ++col) {
+            for (int row = 0; row < 3; ++row) {
+                result(row, col) = m[col * 3 + row];
+            }
+        }
+        return result;
+    }
+
+    constexpr AffineTransform operator*(const AffineTransform& other) const {
+        AffineTransform result;
+        for (int col = 0; col < 4; ++col) {
+            const float* b = other.m + col * 3;
+            for (int row = 0; row < 3; ++row) {
+                result.m[col * 3 + row] = m[row] * b[0] + m[3 + row] * b[1] + m[6 + row] * b[2];
+            }
+        }
+        result.m[9] += m[9];
+        result.m[10] += m[10];
+        result.m[11] += m[11];
+        return result;
+    }
+    constexpr AffineTransform& operator*=(const AffineTransform& other) {
+        *this = *this * other;
+        return *this;
+    }
+
+    constexpr bool operator==(const AffineTransform& other) const {
+        for (int i = 0; i < 12; ++i) {
+            if (!MathUtils::Approximately(m[i], other.m[i])) {
+                return false;
+            }
+        }
+        return true;
+    }
+    constexpr bool operator!=(const AffineTransform& other) const { return !(*this == other); }
+
+    constexpr Vector3 TransformPoint(const Vector3& point) const {
+        return Vector3(m[0] * point.x + m[3] * point.y + m[6] * point.z + m[9],
+                       m[1] * point.x + m[4] * point.y + m[7] * point.z + m[10],
+                       m[2] * point.x + m[5] * point.y + m[8] * point.z + m[11]);
+    }
+    constexpr Vector3 TransformDirection(const Vector3& direction) const {
+        return Vector3(m[0] * direction.x + m[3] * direction.y + m[6] * direction.z,
+                       m[1] * direction.x + m[4] * direction.y + m[7] * direction.z,
+                       m[2] * direction.x + m[5] * direction.y + m[8] * direction.z);
+    }
+    void TransformPoints(const Vector3* in, Vector3* out, size_t count) const {
+        ToMatrix4().TransformPoints(in, out, count);
+    }
+
+    constexpr AffineTransform Inverted() const {
+        Vector3 a(m[0], m[1], m[2]);
+        Vector3 b(m[3], m[4], m[5]);
+        Vector3 c(m[6], m[7], m[8]);
+        Vector3 r0 = b.Cross(c);
+        Vector3 r1 = c.Cross(a);
+        Vector3 r2 = a.Cross(b);
+
+        float det = a.Dot(r0);
+        if (MathUtils::Approximately(det, 0.0f)) {
+            return Identity();
+        }
+
+        float invDet = 1.0f / det;
+        r0 *= invDet;
+        r1 *= invDet;
+        r2 *= invDet;
+
+        AffineTransform result;
+        result.m[0] = r0.x; result.m[3] = r0.y; result.m[6] = r0.z;
+        result.m[1] = r1.x; result.m[4] = r1.y; result.m[7] = r1.z;
+        result.m[2] = r2.x; result.m[5] = r2.y; result.m[8] = r2.z;
+
+        Vector3 translation = GetTranslation();
+        result.m[9] = -r0.Dot(translation);
+        result.m[10] = -r1.Dot(translation);
+        result.m[11] = -r2.Dot(translation);
+        return result;
+    }
+
+    constexpr Matrix4 ToMatrix4() const {
+        Matrix4 result = Matrix4::Identity();
+        for (int col = 0; col < 4; ++col) {
+            for (int row = 0; row < 3; ++row) {
+                result(row, col) = m[col * 3 + row];
+            }
+        }
+        return result;
+    }
+
+    static constexpr AffineTransform Identity() { return AffineTransform(); }
+    static constexpr AffineTransform Translation(const Vector3& translation) {
+        return AffineTransform(Matrix3::Identity(), translation);
+    }
+    static constexpr AffineTransform Scaling(const Vector3& scale) {
+        AffineTransform result;
+        result.m[0] = scale.x;
+        result.m[4] = scale.y;
+        result.m[8] = scale.z;
+        return result;
+    }
+    static constexpr AffineTransform Rotation(const Quaternion& rotation) {
+        return AffineTransform(rotation.ToMatrix3(), Vector3::Zero);
+    }
+    static constexpr AffineTransform FromTRS(const Vector3& translation, const Quaternion& rotation, const Vector3& scale) {
+        AffineTransform result(rotation.ToMatrix3(), translation);
+        for (int row = 0; row < 3; ++row) {
+            result.m[row] *= scale.x;
+            result.m[3 + row] *= scale.y;
+            result.m[6 + row] *= scale.z;
+        }
+        return result;
+    }
+
+    static void Propagate(const int* parentIndices, const AffineTransform* locals, AffineTransform* worlds, size_t count);
+};
+
+}
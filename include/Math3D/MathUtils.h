@@ -1,22 +1,44 @@
 #pragma once
+#include <cstddef>
+#include <cstdint>
 
 namespace Math3D {
 
 class MathUtils {
 public:
-    static const float PI;
-    static const float DEG_TO_RAD;
-    static const float RAD_TO_DEG;
-    static const float EPSILON;
-
-    static float Radians(float degrees);
-    static float Degrees(float radians);
-    
-    static float Clamp(float value, float min, float max);
-    static float Lerp(float a, float b, float t);
-    static float SmoothStep(float edge0, float edge1, float x);
-    
-    static bool Approximately(float a, float b, float epsilon = EPSILON);
+    static constexpr float PI = 3.14159265358979323846f;
+    static constexpr float DEG_TO_RAD = PI / 180.0f;
+    static constexpr float RAD_TO_DEG = 180.0f / PI;
+    static constexpr float EPSILON = 1e-6f;
+
+    static constexpr float Radians(float degrees) { return degrees * DEG_TO_RAD; }
+    static constexpr float Degrees(float radians) { return radians * RAD_TO_DEG; }
+
+    static constexpr float Clamp(float value, float min, float max) {
+        if (value < min) return min;
+        if (value > max) return max;
+        return value;
+    }
+    static constexpr float Lerp(float a, float b, float t) { return a + (b - a) * t; }
+    static constexpr float SmoothStep(float edge0, float edge1, float x) {
+        x = Clamp((x - edge0) / (edge1 - edge0), 0.0f, 1.0f);
+        return x * x * (3.0f - 2.0f * x);
+    }
+
+    static constexpr bool Approximately(float a, float b, float epsilon = EPSILON) {
+        float difference = a - b;
+        return (difference < 0.0f ? -difference : difference) <= epsilon;
+    }
+
+    static constexpr float SINCOS_MAX_ERROR = 1e-7f;
+    static constexpr float SINCOS_REDUCTION_LIMIT = 8192.0f;
+
+    static void SinCos(float angle, float& sine, float& cosine);
+    static void SinCosBatch(const float* angles, float* sines, float* cosines, size_t count);
+    static void SinCosRing(float start, float step, size_t count, float* sines, float* cosines);
+
+    static uint16_t FloatToHalf(float value);
+    static float HalfToFloat(uint16_t value);
 };
 
-} 
+}
@@ -5,20 +5,90 @@ namespace Math3D {
 
 class Matrix3 {
 private:
-    float m[9]; 
+    float m[9];
 
 public:
-    Matrix3();
-    explicit Matrix3(const float data[9]);
-    
-    float& operator()(int row, int col);
-    float operator()(int row, int col) const;
-    
-    Matrix3 Transposed() const;
-    Matrix3 operator*(const Matrix3& other) const;
-    Vector3 operator*(const Vector3& vector) const;
-    
-    static Matrix3 Identity();
+    constexpr Matrix3() : m{} {}
+    constexpr explicit Matrix3(const float data[9]) : m{} {
+        for (int i = 0; i < 9; ++i) {
+            m[i] = data[i];
+        }
+    }
+
+    constexpr float& operator()(int row, int col) { return m[col * 3 + row]; }
+    constexpr float operator()(int row, int col) const { return m[col * 3 + row]; }
+    constexpr const float* Data() const { return m; }
+
+    constexpr Vector3 GetColumn(int col) const { return Vector3(m[col * 3], m[col * 3 + 1], m[col * 3 + 2]); }
+    constexpr void SetColumn(int col, const Vector3& column) {
+        m[col * 3] = column.x;
+        m[col * 3 + 1] = column.y;
+        m[col * 3 + 2] = column.z;
+    }
+
+    constexpr float Determinant() const { return GetColumn(0).Dot(GetColumn(1).Cross(GetColumn(2))); }
+
+    constexpr Matrix3 Cofactor() const {
+        Vector3 c0 = GetColumn(0), c1 = GetColumn(1), c2 = GetColumn(2);
+        Matrix3 result;
+        result.SetColumn(0, c1.Cross(c2));
+        result.SetColumn(1, c2.Cross(c0));
+        result.SetColumn(2, c0.Cross(c1));
+        return result;
+    }
+
+    constexpr Matrix3 InverseTranspose() const {
+        Matrix3 result = Cofactor();
+        float det = GetColumn(0).Dot(result.GetColumn(0));
+        if (det == 0.0f) {
+            return result;
+        }
+        float invDet = 1.0f / det;
+        for (int i = 0; i < 9; ++i) {
+            result.m[i] *= invDet;
+        }
+        return result;
+    }
+
+    constexpr Matrix3 Transposed() const {
+        Matrix3 result;
+        for (int row = 0; row < 3; ++row) {
+            for (int col = 0; col < 3; ++col) {
+                result(row, col) = (*this)(col, row);
+            }
+        }
+        return result;
+    }
+
+    constexpr Matrix3 operator*(const Matrix3& other) const {
+        Matrix3 result;
+        for (int col = 0; col < 3; ++col) {
+            for (int row = 0; row < 3; ++row) {
+                float sum = 0.0f;
+                for (int k = 0; k < 3; ++k) {
+                    sum += (*this)(row, k) * other(k, col);
+                }
+                result(row, col) = sum;
+            }
+        }
+        return result;
+    }
+
+    constexpr Vector3 operator*(const Vector3& vector) const {
+        return Vector3(
+            m[0] * vector.x + m[3] * vector.y + m[6] * vector.z,
+            m[1] * vector.x + m[4] * vector.y + m[7] * vector.z,
+            m[2] * vector.x + m[5] * vector.y + m[8] * vector.z
+        );
+    }
+
+    static constexpr Matrix3 Identity() {
+        Matrix3 result;
+        result(0, 0) = 1.0f;
+        result(1, 1) = 1.0f;
+        result(2, 2) = 1.0f;
+        return result;
+    }
 };
 
-} 
+}
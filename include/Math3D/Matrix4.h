@@ -1,58 +1,218 @@
 #pragma once
 
+#include "Math3D/MathUtils.h"
+#include "Math3D/Matrix3.h"
+#include "Math3D/SIMD.h"
 #include "Math3D/Vector3.h"
 #include "Math3D/Vector4.h"
+#include <cstddef>
+
+#if defined(TERM3D_X86_SIMD) && (defined(__SSE2__) || defined(_M_X64))
+#include <emmintrin.h>
+#define TERM3D_INLINE_SSE2 1
+#endif
 
 namespace Math3D {
 
+class Quaternion;
+
 class Matrix4 {
 private:
-    float m[16]; 
+    float m[16];
 
 public:
-    Matrix4();
-    Matrix4(const Matrix4& other) = default;
-    explicit Matrix4(const float data[16]);
-    
-    Matrix4& operator=(const Matrix4& other) = default;
-    
-    float& operator()(int row, int col);
-    float operator()(int row, int col) const;
-    const float* Data() const { return m; }
-    
-    Matrix4 operator+(const Matrix4& other) const;
-    Matrix4 operator-(const Matrix4& other) const;
+    constexpr Matrix4() : m{} {}
+    constexpr Matrix4(const Matrix4& other) = default;
+    constexpr explicit Matrix4(const float data[16]) : m{} {
+        for (int i = 0; i < 16; ++i) {
+            m[i] = data[i];
+        }
+    }
+
+    constexpr Matrix4& operator=(const Matrix4& other) = default;
+
+    constexpr float& operator()(int row, int col) { return m[col * 4 + row]; }
+    constexpr float operator()(int row, int col) const { return m[col * 4 + row]; }
+    constexpr const float* Data() const { return m; }
+
+    constexpr Matrix4 operator+(const Matrix4& other) const {
+        Matrix4 result;
+        for (int i = 0; i < 16; ++i) {
+            result.m[i] = m[i] + other.m[i];
+        }
+        return result;
+    }
+    constexpr Matrix4 operator-(const Matrix4& other) const {
+        Matrix4 result;
+        for (int i = 0; i < 16; ++i) {
+            result.m[i] = m[i] - other.m[i];
+        }
+        return result;
+    }
     Matrix4 operator*(const Matrix4& other) const;
     Vector4 operator*(const Vector4& vector) const;
-    Matrix4 operator*(float scalar) const;
-    
-    Matrix4& operator+=(const Matrix4& other);
-    Matrix4& operator-=(const Matrix4& other);
-    Matrix4& operator*=(const Matrix4& other);
-    Matrix4& operator*=(float scalar);
-    
-    bool operator==(const Matrix4& other) const;
-    bool operator!=(const Matrix4& other) const;
-    
-    Matrix4 Transposed() const;
-    float Determinant() const;
-    bool IsAffine() const;
+    constexpr Matrix4 operator*(float scalar) const {
+        Matrix4 result;
+        for (int i = 0; i < 16; ++i) {
+            result.m[i] = m[i] * scalar;
+        }
+        return result;
+    }
+
+    void TransformPoints(const Vector3* in, Vector3* out, size_t count) const;
+    void TransformDirections(const Vector3* in, Vector3* out, size_t count) const;
+    void TransformPointsProjective(const Vector3* in, Vector3* out, size_t count) const;
+
+    constexpr Matrix4& operator+=(const Matrix4& other) {
+        for (int i = 0; i < 16; ++i) {
+            m[i] += other.m[i];
+        }
+        return *this;
+    }
+    constexpr Matrix4& operator-=(const Matrix4& other) {
+        for (int i = 0; i < 16; ++i) {
+            m[i] -= other.m[i];
+        }
+        return *this;
+    }
+    Matrix4& operator*=(const Matrix4& other) {
+        *this = *this * other;
+        return *this;
+    }
+    constexpr Matrix4& operator*=(float scalar) {
+        for (int i = 0; i < 16; ++i) {
+            m[i] *= scalar;
+        }
+        return *this;
+    }
+
+    constexpr bool operator==(const Matrix4& other) const {
+        for (int i = 0; i < 16; ++i) {
+            if (!MathUtils::Approximately(m[i], other.m[i])) {
+                return false;
+            }
+        }
+        return true;
+    }
+    constexpr bool operator!=(const Matrix4& other) const { return !(*this == other); }
+
+    constexpr Matrix4 Transposed() const {
+        Matrix4 result;
+        for (int row = 0; row < 4; ++row) {
+            for (int col = 0; col < 4; ++col) {
+                result(row, col) = (*this)(col, row);
+            }
+        }
+        return result;
+    }
+
+    constexpr float Determinant() const {
+        float det = 0.0f;
+        det += m[0] * (m[5] * (m[10] * m[15] - m[11] * m[14]) -
+                       m[6] * (m[9] * m[15] - m[11] * m[13]) +
+                       m[7] * (m[9] * m[14] - m[10] * m[13]));
+        det -= m[1] * (m[4] * (m[10] * m[15] - m[11] * m[14]) -
+                       m[6] * (m[8] * m[15] - m[11] * m[12]) +
+                       m[7] * (m[8] * m[14] - m[10] * m[12]));
+        det += m[2] * (m[4] * (m[9] * m[15] - m[11] * m[13]) -
+                       m[5] * (m[8] * m[15] - m[11] * m[12]) +
+                       m[7] * (m[8] * m[13] - m[9] * m[12]));
+        det -= m[3] * (m[4] * (m[9] * m[14] - m[10] * m[13]) -
+                       m[5] * (m[8] * m[14] - m[10] * m[12]) +
+                       m[6] * (m[8] * m[13] - m[9] * m[12]));
+        return det;
+    }
+
+    constexpr bool IsAffine() const {
+        return MathUtils::Approximately(m[3], 0.0f) &&
+               MathUtils::Approximately(m[7], 0.0f) &&
+               MathUtils::Approximately(m[11], 0.0f) &&
+               MathUtils::Approximately(m[15], 1.0f);
+    }
     Matrix4 FastInvertAffine() const;
     Matrix4 Inverted() const;
-    
-    static Matrix4 Identity();
-    static Matrix4 Translation(const Vector3& translation);
-    static Matrix4 Scaling(const Vector3& scale);
+    static void InvertBatch(const Matrix4* in, Matrix4* out, size_t count);
+
+    constexpr Matrix3 GetUpper3x3() const {
+        Matrix3 result;
+        for (int col = 0; col < 3; ++col) {
+            for (int row = 0; row < 3; ++row) {
+                result(row, col) = m[col * 4 + row];
+            }
+        }
+        return result;
+    }
+    constexpr Matrix3 NormalMatrix() const { return GetUpper3x3().InverseTranspose(); }
+
+    static constexpr Matrix4 Identity() {
+        Matrix4 result;
+        result(0, 0) = 1.0f;
+        result(1, 1) = 1.0f;
+        result(2, 2) = 1.0f;
+        result(3, 3) = 1.0f;
+        return result;
+    }
+    static constexpr Matrix4 Translation(const Vector3& translation) {
+        Matrix4 result = Identity();
+        result(0, 3) = translation.x;
+        result(1, 3) = translation.y;
+        result(2, 3) = translation.z;
+        return result;
+    }
+    static constexpr Matrix4 Scaling(const Vector3& scale) {
+        Matrix4 result = Identity();
+        result(0, 0) = scale.x;
+        result(1, 1) = scale.y;
+        result(2, 2) = scale.z;
+        return result;
+    }
     static Matrix4 RotationX(float angle);
     static Matrix4 RotationY(float angle);
     static Matrix4 RotationZ(float angle);
-    
+
+    static Matrix4 FromTRS(const Vector3& translation, const Quaternion& rotation, const Vector3& scale);
+    static Matrix4 FromTRS(const Vector3& translation, const Vector3& eulerAngles, const Vector3& scale);
+    static void FromTRSBatch(const Vector3* translations, const Quaternion* rotations, const Vector3* scales,
+                             Matrix4* out, size_t count);
+    static void FromTRSBatch(const Vector3* translations, const Vector3* eulerAngles, const Vector3* scales,
+                             Matrix4* out, size_t count);
+
     static Matrix4 Perspective(float fov, float aspect, float near, float far);
-    static Matrix4 Orthographic(float left, float right, float bottom, float top, float near, float far);
-    
+    static constexpr Matrix4 Orthographic(float left, float right, float bottom, float top, float near, float far) {
+        Matrix4 result = Identity();
+        result(0, 0) = 2.0f / (right - left);
+        result(1, 1) = 2.0f / (top - bottom);
+        result(2, 2) = -2.0f / (far - near);
+        result(0, 3) = -(right + left) / (right - left);
+        result(1, 3) = -(top + bottom) / (top - bottom);
+        result(2, 3) = -(far + near) / (far - near);
+        return result;
+    }
+
     static Matrix4 LookAt(const Vector3& eye, const Vector3& target, const Vector3& up);
 };
 
-Matrix4 operator*(float scalar, const Matrix4& matrix);
+inline Vector4 Matrix4::operator*(const Vector4& vector) const {
+#if defined(TERM3D_INLINE_SSE2)
+    __m128 sum = _mm_mul_ps(_mm_loadu_ps(m), _mm_set1_ps(vector.x));
+    sum = _mm_add_ps(sum, _mm_mul_ps(_mm_loadu_ps(m + 4), _mm_set1_ps(vector.y)));
+    sum = _mm_add_ps(sum, _mm_mul_ps(_mm_loadu_ps(m + 8), _mm_set1_ps(vector.z)));
+    sum = _mm_add_ps(sum, _mm_mul_ps(_mm_loadu_ps(m + 12), _mm_set1_ps(vector.w)));
+    Vector4 result;
+    _mm_storeu_ps(&result.x, sum);
+    return result;
+#else
+    return Vector4(
+        m[0] * vector.x + m[4] * vector.y + m[8] * vector.z + m[12] * vector.w,
+        m[1] * vector.x + m[5] * vector.y + m[9] * vector.z + m[13] * vector.w,
+        m[2] * vector.x + m[6] * vector.y + m[10] * vector.z + m[14] * vector.w,
+        m[3] * vector.x + m[7] * vector.y + m[11] * vector.z + m[15] * vector.w
+    );
+#endif
+}
+
+constexpr Matrix4 operator*(float scalar, const Matrix4& matrix) {
+    return matrix * scalar;
+}
 
-} 
+}
@@ -0,0 +1,112 @@
+#pragma once
+#include "Math3D/Matrix3.h"
+#include "Math3D/Matrix4.h"
+#include "Math3D/Vector3.h"
+#include <cmath>
+#include <cstddef>
+
+namespace Math3D {
+
+class Quaternion {
+public:
+    float x, y, z, w;
+
+    constexpr Quaternion() : x(0.0f), y(0.0f), z(0.0f), w(1.0f) {}
+    constexpr Quaternion(float x, float y, float z, float w) : x(x), y(y), z(z), w(w) {}
+    constexpr Quaternion(const Quaternion& other) = default;
+
+    constexpr Quaternion& operator=(const Quaternion& other) = default;
+
+    constexpr Quaternion operator*(const Quaternion& other) const {
+        return Quaternion(
+            w * other.x + x * other.w + y * other.z - z * other.y,
+            w * other.y - x * other.z + y * other.w + z * other.x,
+            w * other.z + x * other.y - y * other.x + z * other.w,
+            w * other.w - x * other.x - y * other.y - z * other.z
+        );
+    }
+    constexpr Quaternion operator*(float scalar) const {
+        return Quaternion(x * scalar, y * scalar, z * scalar, w * scalar);
+    }
+    constexpr Quaternion operator+(const Quaternion& other) const {
+        return Quaternion(x + other.x, y + other.y, z + other.z, w + other.w);
+    }
+    constexpr Quaternion operator-() const { return Quaternion(-x, -y, -z, -w); }
+    constexpr Quaternion& operator*=(const Quaternion& other) {
+        *this = *this * other;
+        return *this;
+    }
+
+    constexpr bool operator==(const Quaternion& other) const {
+        return x == other.x && y == other.y && z == other.z && w == other.w;
+    }
+    constexpr bool operator!=(const Quaternion& other) const { return !(*this == other); }
+
+    constexpr float Dot(const Quaternion& other) const { return x * other.x + y * other.y + z * other.z + w * other.w; }
+    constexpr float LengthSquared() const { return Dot(*this); }
+    float Length() const { return std::sqrt(LengthSquared()); }
+    Quaternion Normalized() const {
+        float len = Length();
+        if (len > 0.0f) {
+            return *this * (1.0f / len);
+        }
+        return Identity();
+    }
+    void Normalize() { *this = Normalized(); }
+
+    constexpr Quaternion Conjugate() const { return Quaternion(-x, -y, -z, w); }
+    constexpr Quaternion Inverse() const {
+        float lengthSquared = LengthSquared();
+        if (lengthSquared <= 0.0f) {
+            return Identity();
+        }
+        return Conjugate() * (1.0f / lengthSquared);
+    }
+
+    constexpr Vector3 Rotate(const Vector3& vector) const {
+        Vector3 axis(x, y, z);
+        Vector3 t = axis.Cross(vector) * 2.0f;
+        return vector + t * w + axis.Cross(t);
+    }
+
+    constexpr Matrix3 ToMatrix3() const {
+        float xx = x * x, yy = y * y, zz = z * z;
+        float xy = x * y, xz = x * z, yz = y * z;
+        float wx = w * x, wy = w * y, wz = w * z;
+
+        Matrix3 result;
+        result(0, 0) = 1.0f - 2.0f * (yy + zz);
+        result(0, 1) = 2.0f * (xy - wz);
+        result(0, 2) = 2.0f * (xz + wy);
+        result(1, 0) = 2.0f * (xy + wz);
+        result(1, 1) = 1.0f - 2.0f * (xx + zz);
+        result(1, 2) = 2.0f * (yz - wx);
+        result(2, 0) = 2.0f * (xz - wy);
+        result(2, 1) = 2.0f * (yz + wx);
+        result(2, 2) = 1.0f - 2.0f * (xx + yy);
+        return result;
+    }
+
+    constexpr Matrix4 ToMatrix4() const {
+        Matrix3 rotation = ToMatrix3();
+        Matrix4 result = Matrix4::Identity();
+        for (int row = 0; row < 3; ++row) {
+            for (int col = 0; col < 3; ++col) {
+                result(row, col) = rotation(row, col);
+            }
+        }
+        return result;
+    }
+
+    static constexpr Quaternion Identity() { return Quaternion(0.0f, 0.0f, 0.0f, 1.0f); }
+    static Quaternion FromAxisAngle(const Vector3& axis, float angle);
+    static Quaternion FromEuler(float pitch, float yaw, float roll);
+
+    static Quaternion Nlerp(const Quaternion& from, const Quaternion& to, float t);
+    static Quaternion Slerp(const Quaternion& from, const Quaternion& to, float t);
+
+    static void NlerpBatch(const Quaternion* from, const Quaternion* to, const float* t, Quaternion* out, size_t count);
+    static void SlerpBatch(const Quaternion* from, const Quaternion* to, const float* t, Quaternion* out, size_t count);
+};
+
+}
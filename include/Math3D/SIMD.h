@@ -0,0 +1,38 @@
+#pragma once
+
+#if !defined(TERM3D_DISABLE_SIMD) && \
+    (defined(__x86_64__) || defined(__i386__) || defined(_M_X64) || defined(_M_IX86))
+#define TERM3D_X86_SIMD 1
+#endif
+
+#if defined(TERM3D_X86_SIMD) && (defined(__GNUC__) || defined(__clang__))
+#define TERM3D_TARGET_SSE2 __attribute__((target("sse2")))
+#define TERM3D_TARGET_SSE41 __attribute__((target("sse4.1")))
+#define TERM3D_TARGET_AVX __attribute__((target("avx")))
+#define TERM3D_TARGET_AVX2 __attribute__((target("avx2")))
+#else
+#define TERM3D_TARGET_SSE2
+#define TERM3D_TARGET_SSE41
+#define TERM3D_TARGET_AVX
+#define TERM3D_TARGET_AVX2
+#endif
+
+namespace Math3D {
+
+enum class SIMDLevel {
+    Scalar = 0,
+    SSE2 = 1,
+    SSE41 = 2,
+    AVX = 3,
+    AVX2 = 4
+};
+
+class SIMD {
+public:
+    static SIMDLevel GetLevel();
+    static const char* GetLevelName(SIMDLevel level);
+
+    static bool Supports(SIMDLevel level) { return GetLevel() >= level; }
+};
+
+}
@@ -1,4 +1,5 @@
 #pragma once
+#include <cmath>
 
 namespace Math3D {
 
@@ -6,37 +7,75 @@ class Vector2 {
 public:
     float x, y;
 
-    Vector2();
-    Vector2(float x, float y);
-    Vector2(const Vector2& other) = default;
+    constexpr Vector2() : x(0.0f), y(0.0f) {}
+    constexpr Vector2(float x, float y) : x(x), y(y) {}
+    constexpr Vector2(const Vector2& other) = default;
 
-    Vector2& operator=(const Vector2& other) = default;
+    constexpr Vector2& operator=(const Vector2& other) = default;
 
-    Vector2 operator+(const Vector2& other) const;
-    Vector2 operator-(const Vector2& other) const;
-    Vector2 operator*(float scalar) const;
-    Vector2 operator/(float scalar) const;
+    constexpr Vector2 operator+(const Vector2& other) const { return Vector2(x + other.x, y + other.y); }
+    constexpr Vector2 operator-(const Vector2& other) const { return Vector2(x - other.x, y - other.y); }
+    constexpr Vector2 operator*(float scalar) const { return Vector2(x * scalar, y * scalar); }
+    constexpr Vector2 operator/(float scalar) const {
+        float invScalar = 1.0f / scalar;
+        return Vector2(x * invScalar, y * invScalar);
+    }
 
-    Vector2& operator+=(const Vector2& other);
-    Vector2& operator-=(const Vector2& other);
-    Vector2& operator*=(float scalar);
-    Vector2& operator/=(float scalar);
+    constexpr Vector2& operator+=(const Vector2& other) {
+        x += other.x;
+        y += other.y;
+        return *this;
+    }
+    constexpr Vector2& operator-=(const Vector2& other) {
+        x -= other.x;
+        y -= other.y;
+        return *this;
+    }
+    constexpr Vector2& operator*=(float scalar) {
+        x *= scalar;
+        y *= scalar;
+        return *this;
+    }
+    constexpr Vector2& operator/=(float scalar) {
+        float invScalar = 1.0f / scalar;
+        x *= invScalar;
+        y *= invScalar;
+        return *this;
+    }
 
-    bool operator==(const Vector2& other) const;
-    bool operator!=(const Vector2& other) const;
+    constexpr bool operator==(const Vector2& other) const { return x == other.x && y == other.y; }
+    constexpr bool operator!=(const Vector2& other) const { return !(*this == other); }
+
+    constexpr float Dot(const Vector2& other) const { return x * other.x + y * other.y; }
+    float Length() const { return std::sqrt(LengthSquared()); }
+    constexpr float LengthSquared() const { return x * x + y * y; }
+    Vector2 Normalized() const {
+        float len = Length();
+        if (len > 0.0f) {
+            return *this / len;
+        }
+        return Zero;
+    }
+    void Normalize() {
+        float len = Length();
+        if (len > 0.0f) {
+            *this /= len;
+        }
+    }
 
-    float Dot(const Vector2& other) const;
-    float Length() const;
-    float LengthSquared() const;
-    Vector2 Normalized() const;
-    void Normalize();
-    
     static const Vector2 Zero;
     static const Vector2 One;
     static const Vector2 UnitX;
     static const Vector2 UnitY;
 };
 
-Vector2 operator*(float scalar, const Vector2& vector);
+inline constexpr Vector2 Vector2::Zero(0.0f, 0.0f);
+inline constexpr Vector2 Vector2::One(1.0f, 1.0f);
+inline constexpr Vector2 Vector2::UnitX(1.0f, 0.0f);
+inline constexpr Vector2 Vector2::UnitY(0.0f, 1.0f);
+
+constexpr Vector2 operator*(float scalar, const Vector2& vector) {
+    return vector * scalar;
+}
 
-} 
+}
@@ -1,4 +1,5 @@
 #pragma once
+#include <cmath>
 
 namespace Math3D {
 
@@ -6,33 +7,74 @@ class Vector3 {
 public:
     float x, y, z;
 
-    Vector3();
-    Vector3(float x, float y, float z);
-    Vector3(const Vector3& other) = default;
-
-    Vector3& operator=(const Vector3& other) = default;
-
-    Vector3 operator+(const Vector3& other) const;
-    Vector3 operator-(const Vector3& other) const;
-    Vector3 operator-() const;
-    Vector3 operator*(float scalar) const;
-    Vector3 operator/(float scalar) const;
-
-    Vector3& operator+=(const Vector3& other);
-    Vector3& operator-=(const Vector3& other);
-    Vector3& operator*=(float scalar);
-    Vector3& operator/=(float scalar);
-
-    bool operator==(const Vector3& other) const;
-    bool operator!=(const Vector3& other) const;
-
-    float Dot(const Vector3& other) const;
-    Vector3 Cross(const Vector3& other) const;
-    float Length() const;
-    float LengthSquared() const;
-    Vector3 Normalized() const;
-    void Normalize();
-    
+    constexpr Vector3() : x(0.0f), y(0.0f), z(0.0f) {}
+    constexpr Vector3(float x, float y, float z) : x(x), y(y), z(z) {}
+    constexpr Vector3(const Vector3& other) = default;
+
+    constexpr Vector3& operator=(const Vector3& other) = default;
+
+    constexpr Vector3 operator+(const Vector3& other) const { return Vector3(x + other.x, y + other.y, z + other.z); }
+    constexpr Vector3 operator-(const Vector3& other) const { return Vector3(x - other.x, y - other.y, z - other.z); }
+    constexpr Vector3 operator-() const { return Vector3(-x, -y, -z); }
+    constexpr Vector3 operator*(float scalar) const { return Vector3(x * scalar, y * scalar, z * scalar); }
+    constexpr Vector3 operator/(float scalar) const {
+        float invScalar = 1.0f / scalar;
+        return Vector3(x * invScalar, y * invScalar, z * invScalar);
+    }
+
+    constexpr Vector3& operator+=(const Vector3& other) {
+        x += other.x;
+        y += other.y;
+        z += other.z;
+        return *this;
+    }
+    constexpr Vector3& operator-=(const Vector3& other) {
+        x -= other.x;
+        y -= other.y;
+        z -= other.z;
+        return *this;
+    }
+    constexpr Vector3& operator*=(float scalar) {
+        x *= scalar;
+        y *= scalar;
+        z *= scalar;
+        return *this;
+    }
+    constexpr Vector3& operator/=(float scalar) {
+        float invScalar = 1.0f / scalar;
+        x *= invScalar;
+        y *= invScalar;
+        z *= invScalar;
+        return *this;
+    }
+
+    constexpr bool operator==(const Vector3& other) const { return x == other.x && y == other.y && z == other.z; }
+    constexpr bool operator!=(const Vector3& other) const { return !(*this == other); }
+
+    constexpr float Dot(const Vector3& other) const { return x * other.x + y * other.y + z * other.z; }
+    constexpr Vector3 Cross(const Vector3& other) const {
+        return Vector3(
+            y * other.z - z * other.y,
+            z * other.x - x * other.z,
+            x * other.y - y * other.x
+        );
+    }
+    float Length() const { return std::sqrt(LengthSquared()); }
+    constexpr float LengthSquared() const { return x * x + y * y + z * z; }
+    Vector3 Normalized() const {
+        float len = Length();
+        if (len > 0.0f) {
+            return *this / len;
+        }
+        return Zero;
+    }
+    void Normalize() {
+        float len = Length();
+        if (len > 0.0f) {
+            *this /= len;
+        }
+    }
+
     static const Vector3 Zero;
     static const Vector3 One;
     static const Vector3 UnitX;
@@ -40,6 +82,14 @@ public:
     static const Vector3 UnitZ;
 };
 
-Vector3 operator*(float scalar, const Vector3& vector);
+inline constexpr Vector3 Vector3::Zero(0.0f, 0.0f, 0.0f);
+inline constexpr Vector3 Vector3::One(1.0f, 1.0f, 1.0f);
+inline constexpr Vector3 Vector3::UnitX(1.0f, 0.0f, 0.0f);
+inline constexpr Vector3 Vector3::UnitY(0.0f, 1.0f, 0.0f);
+inline constexpr Vector3 Vector3::UnitZ(0.0f, 0.0f, 1.0f);
+
+constexpr Vector3 operator*(float scalar, const Vector3& vector) {
+    return vector * scalar;
+}
 
-} 
+}
@@ -0,0 +1,59 @@
+#pragma once
+#include "Math3D/AlignedAllocator.h"
+#include "Math3D/Vector3.h"
+#include <cstddef>
+#include <vector>
+
+namespace Math3D {
+
+class Matrix3;
+class Matrix4;
+
+class Vector3Stream {
+public:
+    static constexpr size_t ALIGNMENT = 32;
+    using FloatArray = std::vector<float, AlignedAllocator<float, ALIGNMENT>>;
+
+    Vector3Stream() = default;
+    explicit Vector3Stream(size_t count);
+    Vector3Stream(const Vector3* data, size_t count);
+
+    size_t Size() const { return m_x.size(); }
+    bool Empty() const { return m_x.empty(); }
+    void Resize(size_t count);
+    void Reserve(size_t count);
+    void Clear();
+
+    void PushBack(const Vector3& value);
+    Vector3 Get(size_t index) const { return Vector3(m_x[index], m_y[index], m_z[index]); }
+    void Set(size_t index, const Vector3& value);
+
+    void Assign(const Vector3* data, size_t count);
+    void CopyTo(Vector3* out) const;
+
+    float* X() { return m_x.data(); }
+    float* Y() { return m_y.data(); }
+    float* Z() { return m_z.data(); }
+    const float* X() const { return m_x.data(); }
+    const float* Y() const { return m_y.data(); }
+    const float* Z() const { return m_z.data(); }
+
+    static void Add(const Vector3Stream& a, const Vector3Stream& b, Vector3Stream& out);
+    static void Subtract(const Vector3Stream& a, const Vector3Stream& b, Vector3Stream& out);
+    static void Scale(const Vector3Stream& a, float scalar, Vector3Stream& out);
+    static void Dot(const Vector3Stream& a, const Vector3Stream& b, float* out);
+    static void Cross(const Vector3Stream& a, const Vector3Stream& b, Vector3Stream& out);
+
+    void Lengths(float* out) const;
+    void Normalize();
+    void TransformPoints(const Matrix4& matrix);
+    void TransformDirections(const Matrix3& matrix);
+    bool MinMax(Vector3& min, Vector3& max) const;
+
+private:
+    FloatArray m_x;
+    FloatArray m_y;
+    FloatArray m_z;
+};
+
+}
@@ -1,8 +1,6 @@
 #pragma once
-
-namespace Math3D {
-    class Vector3;
-}
+#include "Math3D/Vector3.h"
+#include <cmath>
 
 namespace Math3D {
 
@@ -10,38 +8,88 @@ class Vector4 {
 public:
     float x, y, z, w;
 
-    Vector4();
-    Vector4(float x, float y, float z, float w);
-    Vector4(const Vector3& xyz, float w);  
-    Vector4(const Vector4& other) = default;
-
-    Vector4& operator=(const Vector4& other) = default;
-
-    Vector4 operator+(const Vector4& other) const;
-    Vector4 operator-(const Vector4& other) const;
-    Vector4 operator*(float scalar) const;
-    Vector4 operator/(float scalar) const;
-
-    Vector4& operator+=(const Vector4& other);
-    Vector4& operator-=(const Vector4& other);
-    Vector4& operator*=(float scalar);
-    Vector4& operator/=(float scalar);
-
-    bool operator==(const Vector4& other) const;
-    bool operator!=(const Vector4& other) const;
-
-    float Dot(const Vector4& other) const;
-    float Length() const;
-    float LengthSquared() const;
-    Vector4 Normalized() const;
-    void Normalize();
-    
-    Vector3 XYZ() const;
-    
+    constexpr Vector4() : x(0.0f), y(0.0f), z(0.0f), w(0.0f) {}
+    constexpr Vector4(float x, float y, float z, float w) : x(x), y(y), z(z), w(w) {}
+    constexpr Vector4(const Vector3& xyz, float w) : x(xyz.x), y(xyz.y), z(xyz.z), w(w) {}
+    constexpr Vector4(const Vector4& other) = default;
+
+    constexpr Vector4& operator=(const Vector4& other) = default;
+
+    constexpr Vector4 operator+(const Vector4& other) const {
+        return Vector4(x + other.x, y + other.y, z + other.z, w + other.w);
+    }
+    constexpr Vector4 operator-(const Vector4& other) const {
+        return Vector4(x - other.x, y - other.y, z - other.z, w - other.w);
+    }
+    constexpr Vector4 operator*(float scalar) const { return Vector4(x * scalar, y * scalar, z * scalar, w * scalar); }
+    constexpr Vector4 operator/(float scalar) const {
+        float invScalar = 1.0f / scalar;
+        return Vector4(x * invScalar, y * invScalar, z * invScalar, w * invScalar);
+    }
+
+    constexpr Vector4& operator+=(const Vector4& other) {
+        x += other.x;
+        y += other.y;
+        z += other.z;
+        w += other.w;
+        return *this;
+    }
+    constexpr Vector4& operator-=(const Vector4& other) {
+        x -= other.x;
+        y -= other.y;
+        z -= other.z;
+        w -= other.w;
+        return *this;
+    }
+    constexpr Vector4& operator*=(float scalar) {
+        x *= scalar;
+        y *= scalar;
+        z *= scalar;
+        w *= scalar;
+        return *this;
+    }
+    constexpr Vector4& operator/=(float scalar) {
+        float invScalar = 1.0f / scalar;
+        x *= invScalar;
+        y *= invScalar;
+        z *= invScalar;
+        w *= invScalar;
+        return *this;
+    }
+
+    constexpr bool operator==(const Vector4& other) const {
+        return x == other.x && y == other.y && z == other.z && w == other.w;
+    }
+    constexpr bool operator!=(const Vector4& other) const { return !(*this == other); }
+
+    constexpr float Dot(const Vector4& other) const { return x * other.x + y * other.y + z * other.z + w * other.w; }
+    float Length() const { return std::sqrt(LengthSquared()); }
+    constexpr float LengthSquared() const { return x * x + y * y + z * z + w * w; }
+    Vector4 Normalized() const {
+        float len = Length();
+        if (len > 0.0f) {
+            return *this / len;
+        }
+        return Zero;
+    }
+    void Normalize() {
+        float len = Length();
+        if (len > 0.0f) {
+            *this /= len;
+        }
+    }
+
+    constexpr Vector3 XYZ() const { return Vector3(x, y, z); }
+
     static const Vector4 Zero;
     static const Vector4 One;
 };
 
-Vector4 operator*(float scalar, const Vector4& vector);
+inline constexpr Vector4 Vector4::Zero(0.0f, 0.0f, 0.0f, 0.0f);
+inline constexpr Vector4 Vector4::One(1.0f, 1.0f, 1.0f, 1.0f);
 
-} 
+constexpr Vector4 operator*(float scalar, const Vector4& vector) {
+    return vector * scalar;
+}
+
+}
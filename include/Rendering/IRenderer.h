@@ -5,6 +5,9 @@
 
 namespace Geometry {
     class Mesh;  
+    class PackedMesh;
+    class LODGroup;
+    class MeshletMesh;
 }
 
 namespace Rendering {
@@ -28,16 +31,25 @@ public:
     virtual void SetViewport(int x, int y, int width, int height) = 0;
     virtual void SetProjectionMatrix(const Math3D::Matrix4& projection) = 0;
     virtual void SetViewMatrix(const Math3D::Matrix4& view) = 0;
+    virtual const Math3D::Matrix4& GetProjectionMatrix() const;
+    virtual const Math3D::Matrix4& GetViewMatrix() const;
 
     virtual void DrawMesh(const Geometry::Mesh& mesh, const Math3D::Matrix4& transform) = 0;
     virtual void DrawMesh(const Geometry::Mesh& mesh) = 0;
+    virtual void DrawPackedMesh(const Geometry::PackedMesh& mesh, const Math3D::Matrix4& transform);
+    virtual void DrawLODGroup(Geometry::LODGroup& group, const Math3D::Matrix4& transform);
+    virtual void DrawMeshlets(const Geometry::Mesh& mesh, const Geometry::MeshletMesh& meshlets,
+                              const Math3D::Matrix4& transform);
 
     virtual const char* GetName() const = 0;
     virtual int GetWidth() const = 0;
     virtual int GetHeight() const = 0;
+    virtual bool ShouldClose() const { return false; }
 
     virtual int GetDrawCallCount() const { return 0; }
     virtual int GetTriangleCount() const { return 0; }
+    virtual int GetBytesWritten() const { return 0; }
+    virtual int GetLODTrianglesSaved() const { return 0; }
     virtual void ResetStatistics() {}
 };
 
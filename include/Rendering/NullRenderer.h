@@ -45,8 +45,14 @@ public:
         m_view = view;
     }
 
+    const Math3D::Matrix4& GetProjectionMatrix() const override { return m_projection; }
+    const Math3D::Matrix4& GetViewMatrix() const override { return m_view; }
+
     void DrawMesh(const Geometry::Mesh& mesh, const Math3D::Matrix4& transform) override {}
     void DrawMesh(const Geometry::Mesh& mesh) override {}
+    void DrawPackedMesh(const Geometry::PackedMesh& mesh, const Math3D::Matrix4& transform) override {}
+    void DrawMeshlets(const Geometry::Mesh& mesh, const Geometry::MeshletMesh& meshlets,
+                      const Math3D::Matrix4& transform) override {}
     
     const char* GetName() const override { return "NullRenderer"; }
     int GetWidth() const override { return m_width; }
@@ -48,6 +48,8 @@ public:
     void SetViewport(int x, int y, int width, int height) override;
     void SetProjectionMatrix(const Math3D::Matrix4& projection) override;
     void SetViewMatrix(const Math3D::Matrix4& view) override;
+    const Math3D::Matrix4& GetProjectionMatrix() const override { return m_projection; }
+    const Math3D::Matrix4& GetViewMatrix() const override { return m_view; }
     
     void DrawMesh(const Geometry::Mesh& mesh, const Math3D::Matrix4& transform) override;
     void DrawMesh(const Geometry::Mesh& mesh) override;
@@ -57,7 +59,7 @@ public:
     int GetHeight() const override { return m_height; }
     
     GLFWwindow* GetWindow() const { return m_window; }
-    bool ShouldClose() const;
+    bool ShouldClose() const override;
 
 private:
     bool InitializeGLFW();
@@ -0,0 +1,138 @@
+#pragma once
+#include "Rendering/IRenderer.h"
+#include "Core/ThreadPool.h"
+#include "Geometry/LODGroup.h"
+#include "Geometry/Mesh.h"
+#include "Geometry/Meshlet.h"
+#include "Geometry/PackedMesh.h"
+#include "Math3D/Matrix4.h"
+#include "Math3D/Vector3.h"
+#include "Math3D/Vector4.h"
+#include <cstdint>
+#include <vector>
+
+namespace Rendering {
+
+class SoftwareRenderer : public IRenderer {
+public:
+    static constexpr int TILE_SIZE = 64;
+
+    explicit SoftwareRenderer(size_t threadCount = 0);
+    ~SoftwareRenderer() override = default;
+
+    bool Initialize(int width, int height, const char* title) override;
+    void Shutdown() override;
+    void Resize(int width, int height) override;
+
+    void BeginFrame() override;
+    void EndFrame() override;
+    void Clear(ClearFlags flags, const Color& color = Color::Black()) override;
+
+    void SetRenderState(RenderState state) override;
+    void EnableState(RenderState state) override;
+    void DisableState(RenderState state) override;
+
+    void SetViewport(int x, int y, int width, int height) override;
+    void SetProjectionMatrix(const Math3D::Matrix4& projection) override;
+    void SetViewMatrix(const Math3D::Matrix4& view) override;
+    const Math3D::Matrix4& GetProjectionMatrix() const override { return m_projection; }
+    const Math3D::Matrix4& GetViewMatrix() const override { return m_view; }
+
+    void DrawMesh(const Geometry::Mesh& mesh, const Math3D::Matrix4& transform) override;
+    void DrawMesh(const Geometry::Mesh& mesh) override;
+    void DrawPackedMesh(const Geometry::PackedMesh& mesh, const Math3D::Matrix4& transform) override;
+    void DrawLODGroup(Geometry::LODGroup& group, const Math3D::Matrix4& transform) override;
+    void DrawMeshlets(const Geometry::Mesh& mesh, const Geometry::MeshletMesh& meshlets,
+                      const Math3D::Matrix4& transform) override;
+
+    const char* GetName() const override { return "SoftwareRenderer"; }
+    int GetWidth() const override { return m_width; }
+    int GetHeight() const override { return m_height; }
+
+    int GetDrawCallCount() const override { return m_drawCallCount; }
+    int GetTriangleCount() const override { return m_triangleCount; }
+    void ResetStatistics() override;
+    int GetCulledMeshCount() const { return m_culledMeshCount; }
+    int GetLODTrianglesSaved() const override { return m_lodTrianglesSaved; }
+    int GetCulledClusterCount() const { return m_culledClusterCount; }
+
+    void SetDrawColor(const Color& color) { m_drawColor = color; }
+    void SetLightDirection(const Math3D::Vector3& direction);
+    void Flush();
+
+    const uint32_t* GetColorBuffer() const { return m_colorBuffer.data(); }
+    const float* GetDepthBuffer() const { return m_depthBuffer.data(); }
+    size_t GetThreadCount() const { return m_threadPool.GetThreadCount(); }
+
+    static uint32_t PackColor(const Color& color);
+    static Color UnpackColor(uint32_t packed);
+
+protected:
+    int m_width = 0;
+    int m_height = 0;
+
+    std::vector<uint32_t> m_colorBuffer;
+    std::vector<float> m_depthBuffer;
+    uint32_t m_clearColor = 0xFF000000u;
+
+    Core::ThreadPool m_threadPool;
+
+private:
+    struct ClipVertex {
+        Math3D::Vector4 position;
+        float intensity;
+    };
+
+    struct RasterTriangle {
+        float edgeA[3], edgeB[3], edgeC[3];
+        float invEdgeLength[3];
+        bool topLeft[3];
+        float invArea;
+        float z[3];
+        float invW[3];
+        float intensity[3];
+        int minX, minY, maxX, maxY;
+        uint32_t color;
+        RenderState state;
+    };
+
+    int m_viewportX = 0;
+    int m_viewportY = 0;
+    int m_viewportWidth = 0;
+    int m_viewportHeight = 0;
+
+    int m_tilesX = 0;
+    int m_tilesY = 0;
+
+    Math3D::Matrix4 m_projection;
+    Math3D::Matrix4 m_view;
+    RenderState m_currentState;
+    Color m_drawColor;
+    Math3D::Vector3 m_lightDirection;
+
+    std::vector<ClipVertex> m_clipVertices;
+    std::vector<RasterTriangle> m_setupScratch;
+    std::vector<uint8_t> m_setupCounts;
+    std::vector<RasterTriangle> m_triangles;
+    std::vector<std::vector<uint32_t>> m_bins;
+    std::vector<uint32_t> m_visibleMeshlets;
+    std::vector<uint32_t> m_clusterOffsets;
+    std::vector<uint32_t> m_clusterIndices;
+
+    int m_drawCallCount = 0;
+    int m_triangleCount = 0;
+    int m_culledMeshCount = 0;
+    int m_lodTrianglesSaved = 0;
+    int m_culledClusterCount = 0;
+
+    void AllocateBuffers(int width, int height);
+    bool BeginDraw(const Geometry::BoundingBox& bounds, const Math3D::Matrix4& mvp, size_t triangleCount);
+    void AssembleTriangles(const std::vector<uint32_t>& indices, size_t vertexCount);
+    int ClipAgainstNearPlane(const ClipVertex* in, ClipVertex* out) const;
+    bool SetupTriangle(const ClipVertex& v0, const ClipVertex& v1, const ClipVertex& v2,
+                       uint32_t color, RasterTriangle& triangle) const;
+    void BinTriangle(const RasterTriangle& triangle);
+    void RasterizeTile(int tileIndex);
+};
+
+}
@@ -0,0 +1,87 @@
+#pragma once
+#include "Rendering/SoftwareRenderer.h"
+#include <cstddef>
+#include <vector>
+
+namespace Rendering {
+
+enum class TerminalOutputMode {
+    HalfBlock,
+    Braille
+};
+
+class TerminalRenderer : public SoftwareRenderer {
+public:
+    explicit TerminalRenderer(int outputFd = 1, size_t threadCount = 0);
+    ~TerminalRenderer() override;
+
+    bool Initialize(int columns, int rows, const char* title) override;
+    void Shutdown() override;
+    void Resize(int columns, int rows) override;
+
+    void EndFrame() override;
+
+    int GetBytesWritten() const override { return m_bytesWritten; }
+    void ResetStatistics() override;
+    void Invalidate() { m_fullRedraw = true; }
+
+    const char* GetName() const override { return "TerminalRenderer"; }
+
+    void SetOutputMode(TerminalOutputMode mode);
+    TerminalOutputMode GetOutputMode() const { return m_outputMode; }
+    void SetBrailleThreshold(float threshold) { m_brailleThreshold = threshold; }
+
+    int GetColumns() const { return m_columns; }
+    int GetRows() const { return m_rows; }
+
+    const char* GetFrameData() const { return m_frameBuffer.data(); }
+    size_t GetFrameSize() const { return m_frameSize; }
+
+    static bool QueryTerminalSize(int outputFd, int& columns, int& rows);
+
+private:
+    struct Cell {
+        uint32_t glyph;
+        uint32_t foreground;
+        uint32_t background;
+
+        bool operator==(const Cell& other) const {
+            return glyph == other.glyph && foreground == other.foreground && background == other.background;
+        }
+        bool operator!=(const Cell& other) const { return !(*this == other); }
+    };
+
+    int m_outputFd;
+    int m_columns = 0;
+    int m_rows = 0;
+    bool m_initialized = false;
+
+    TerminalOutputMode m_outputMode = TerminalOutputMode::HalfBlock;
+    float m_brailleThreshold = 0.1f;
+
+    std::vector<char> m_frameBuffer;
+    size_t m_frameSize = 0;
+
+    std::vector<Cell> m_cells;
+    std::vector<Cell> m_previousCells;
+    std::vector<uint8_t> m_coverage;
+    bool m_fullRedraw = true;
+
+    uint32_t m_activeForeground = 0xFFFFFFFFu;
+    uint32_t m_activeBackground = 0xFFFFFFFFu;
+
+    int m_bytesWritten = 0;
+
+    int GetPixelsPerCellX() const { return m_outputMode == TerminalOutputMode::Braille ? 2 : 1; }
+    int GetPixelsPerCellY() const { return m_outputMode == TerminalOutputMode::Braille ? 4 : 2; }
+
+    void AllocateFrameBuffer();
+    void BuildHalfBlockCells();
+    void BuildBrailleCells();
+    void EncodeFrame();
+    bool MatchesActiveColors(const Cell& cell) const;
+    char* EncodeCell(char* out, const Cell& cell);
+    bool WriteBytes(const char* data, size_t size) const;
+};
+
+}
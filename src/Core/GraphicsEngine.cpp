@@ -1,4 +1,5 @@
 #include "Core/GraphicsEngine.h"
+#include "Rendering/OpenGLRenderer.h"
 
 namespace Core {
 
@@ -9,7 +10,11 @@ GraphicsEngine::~GraphicsEngine() {
 }
 
 bool GraphicsEngine::Initialize(int width, int height, const char* title) {
-    m_renderer = std::make_unique<Rendering::OpenGLRenderer>();
+    return Initialize(std::make_unique<Rendering::OpenGLRenderer>(), width, height, title);
+}
+
+bool GraphicsEngine::Initialize(std::unique_ptr<Rendering::IRenderer> renderer, int width, int height, const char* title) {
+    m_renderer = std::move(renderer);
     return m_renderer->Initialize(width, height, title);
 }
 
@@ -0,0 +1,102 @@
+#include "Core/ThreadPool.h"
+#include <algorithm>
+
+namespace Core {
+
+namespace {
+thread_local bool t_insideParallelFor = false;
+}
+
+ThreadPool::ThreadPool(size_t threadCount) {
+    if (threadCount == 0) {
+        threadCount = std::max(1u, std::thread::hardware_concurrency());
+    }
+
+    for (size_t i = 1; i < threadCount; ++i) {
+        m_workers.emplace_back(&ThreadPool::WorkerLoop, this);
+    }
+}
+
+ThreadPool::~ThreadPool() {
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_stopping = true;
+    }
+    m_wake.notify_all();
+
+    for (auto& worker : m_workers) {
+        worker.join();
+    }
+}
+
+void ThreadPool::WorkerLoop() {
+    t_insideParallelFor = true;
+    uint64_t seenGeneration = 0;
+
+    std::unique_lock<std::mutex> lock(m_mutex);
+    while (true) {
+        m_wake.wait(lock, [&] { return m_stopping || m_generation != seenGeneration; });
+        if (m_stopping) {
+            return;
+        }
+
+        seenGeneration = m_generation;
+        const std::function<void(size_t)>* task = m_task;
+        size_t count = m_taskCount;
+
+        lock.unlock();
+        RunTasks(*task, count);
+        lock.lock();
+
+        if (--m_activeWorkers == 0) {
+            m_done.notify_one();
+        }
+    }
+}
+
+void ThreadPool::RunTasks(const std::function<void(size_t)>& task, size_t count) {
+    size_t index;
+    while ((index = m_nextIndex.fetch_add(1, std::memory_order_relaxed)) < count) {
+        task(index);
+    }
+}
+
+void ThreadPool::ParallelFor(size_t count, const std::function<void(size_t index)>& task) {
+    if (count == 0) {
+        return;
+    }
+
+    if (m_workers.empty() || count == 1 || t_insideParallelFor) {
+        for (size_t i = 0; i < count; ++i) {
+            task(i);
+        }
+        return;
+    }
+
+    std::lock_guard<std::mutex> dispatchLock(m_dispatchMutex);
+
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_task = &task;
+        m_taskCount = count;
+        m_nextIndex.store(0, std::memory_order_relaxed);
+        m_activeWorkers = m_workers.size();
+        ++m_generation;
+    }
+    m_wake.notify_all();
+
+    t_insideParallelFor = true;
+    RunTasks(task, count);
+    t_insideParallelFor = false;
+
+    std::unique_lock<std::mutex> lock(m_mutex);
+    m_done.wait(lock, [&] { return m_activeWorkers == 0; });
+    m_task = nullptr;
+}
+
+ThreadPool& ThreadPool::Global() {
+    static ThreadPool pool;
+    return pool;
+}
+
+}
@@ -0,0 +1,555 @@
+#include "Geometry/BVH.h"
+#include "Core/ThreadPool.h"
+#include <algorithm>
+#include <array>
+#include <chrono>
+#include <cmath>
+#include <numeric>
+
+using Math3D::Vector3;
+
+namespace Geometry {
+
+namespace {
+
+const size_t PARALLEL_SPLIT_TRIANGLES = 16384;
+const size_t BUILD_CHUNK_SIZE = 8192;
+const size_t MIN_BIN_COUNT = 4;
+const float INF = std::numeric_limits<float>::infinity();
+
+struct Aabb {
+    float min[3] = { INF, INF, INF };
+    float max[3] = { -INF, -INF, -INF };
+
+    void Grow(const float* point) {
+        for (int a = 0; a < 3; ++a) {
+            min[a] = std::min(min[a], point[a]);
+            max[a] = std::max(max[a], point[a]);
+        }
+    }
+
+    void Grow(const Aabb& other) {
+        for (int a = 0; a < 3; ++a) {
+            min[a] = std::min(min[a], other.min[a]);
+            max[a] = std::max(max[a], other.max[a]);
+        }
+    }
+
+    float Area() const {
+        if (min[0] > max[0]) {
+            return 0.0f;
+        }
+        float dx = max[0] - min[0];
+        float dy = max[1] - min[1];
+        float dz = max[2] - min[2];
+        return 2.0f * (dx * dy + dy * dz + dz * dx);
+    }
+};
+
+struct BuildPrimitive {
+    Aabb bounds;
+    float centroid[3];
+};
+
+struct Bin {
+    Aabb bounds;
+    uint32_t count = 0;
+};
+
+using BinSet = std::array<std::array<Bin, BVH::BIN_COUNT>, 3>;
+
+struct BuildTask {
+    uint32_t node;
+    uint32_t first;
+    uint32_t count;
+    uint32_t depth;
+    Aabb bounds;
+    Aabb centroidBounds;
+};
+
+struct SplitPlane {
+    int axis = -1;
+    size_t bin = 0;
+    float cost = INF;
+    Aabb leftBounds;
+    Aabb rightBounds;
+};
+
+class BVHBuilder {
+public:
+    BVHBuilder(const std::vector<BuildPrimitive>& primitives, std::vector<uint32_t>& indices, size_t maxLeafTriangles)
+        : m_primitives(primitives), m_indices(indices), m_maxLeafTriangles(maxLeafTriangles) {}
+
+    BuildTask CreateRoot() const {
+        BuildTask root = { 0, 0, static_cast<uint32_t>(m_indices.size()), 0, Aabb(), Aabb() };
+        ComputeBounds(0, root.count, true, root.bounds, root.centroidBounds);
+        return root;
+    }
+
+    bool Process(std::vector<BVHNode>& nodes, const BuildTask& task, bool parallel, BuildTask children[2]) const {
+        BVHNode& node = nodes[task.node];
+        std::copy(task.bounds.min, task.bounds.min + 3, node.boundsMin);
+        std::copy(task.bounds.max, task.bounds.max + 3, node.boundsMax);
+        node.leftFirst = task.first;
+        node.triangleCount = task.count;
+        if (task.count <= 1 || task.depth + 1 >= BVH::MAX_DEPTH) {
+            return false;
+        }
+
+        SplitPlane split = FindSplit(task, parallel);
+        BuildTask& left = children[0];
+        BuildTask& right = children[1];
+        left = { 0, task.first, 0, task.depth + 1, split.leftBounds, Aabb() };
+        right = { 0, 0, 0, task.depth + 1, split.rightBounds, Aabb() };
+        if (split.axis >= 0) {
+            float leafCost = BVH::INTERSECTION_COST * static_cast<float>(task.count);
+            float splitCost = BVH::TRAVERSAL_COST + BVH::INTERSECTION_COST * split.cost / task.bounds.Area();
+            if (task.count <= m_maxLeafTriangles && leafCost <= splitCost) {
+                return false;
+            }
+            left.count = Partition(task, split, left.centroidBounds, right.centroidBounds);
+        } else if (task.count <= m_maxLeafTriangles) {
+            return false;
+        } else {
+            left.count = task.count / 2;
+            left.bounds = Aabb();
+            right.bounds = Aabb();
+            ComputeBounds(task.first, left.count, parallel, left.bounds, left.centroidBounds);
+            ComputeBounds(task.first + left.count, task.count - left.count, parallel, right.bounds,
+                          right.centroidBounds);
+        }
+        right.first = task.first + left.count;
+        right.count = task.count - left.count;
+
+        left.node = static_cast<uint32_t>(nodes.size());
+        right.node = left.node + 1;
+        nodes.emplace_back();
+        nodes.emplace_back();
+        nodes[task.node].leftFirst = left.node;
+        nodes[task.node].triangleCount = 0;
+        return true;
+    }
+
+    void BuildSubtree(std::vector<BVHNode>& nodes, const BuildTask& root) const {
+        std::vector<BuildTask> stack = { root };
+        BuildTask children[2];
+        while (!stack.empty()) {
+            BuildTask task = stack.back();
+            stack.pop_back();
+            if (Process(nodes, task, false, children)) {
+                stack.push_back(children[1]);
+                stack.push_back(children[0]);
+            }
+        }
+    }
+
+private:
+    static size_t BinCount(uint32_t triangleCount) {
+        return std::min<size_t>(BVH::BIN_COUNT, std::max<size_t>(triangleCount, MIN_BIN_COUNT));
+    }
+
+    static float BinScale(const Aabb& centroidBounds, int axis, size_t binCount) {
+        float extent = centroidBounds.max[axis] - centroidBounds.min[axis];
+        return extent > 0.0f ? static_cast<float>(binCount) / extent : 0.0f;
+    }
+
+    static size_t BinIndex(float value, float offset, float scale, size_t binCount) {
+        float bin = (value - offset) * scale;
+        return std::min(static_cast<size_t>(std::max(bin, 0.0f)), binCount - 1);
+    }
+
+    template <typename Body>
+    static void ForEachChunk(size_t first, size_t count, const Body& body) {
+        size_t chunkCount = (count + BUILD_CHUNK_SIZE - 1) / BUILD_CHUNK_SIZE;
+        Core::ThreadPool::Global().ParallelFor(chunkCount, [&](size_t chunk) {
+            size_t begin = first + chunk * BUILD_CHUNK_SIZE;
+            body(chunk, begin, std::min(begin + BUILD_CHUNK_SIZE, first + count));
+        });
+    }
+
+    void GrowBounds(size_t begin, size_t end, Aabb& bounds, Aabb& centroidBounds) const {
+        for (size_t i = begin; i < end; ++i) {
+            const BuildPrimitive& primitive = m_primitives[m_indices[i]];
+            bounds.Grow(primitive.bounds);
+            centroidBounds.Grow(primitive.centroid);
+        }
+    }
+
+    void ComputeBounds(size_t first, size_t count, bool parallel, Aabb& bounds, Aabb& centroidBounds) const {
+        if (!parallel) {
+            GrowBounds(first, first + count, bounds, centroidBounds);
+            return;
+        }
+        std::vector<std::array<Aabb, 2>> partial((count + BUILD_CHUNK_SIZE - 1) / BUILD_CHUNK_SIZE);
+        ForEachChunk(first, count, [&](size_t chunk, size_t begin, size_t end) {
+            GrowBounds(begin, end, partial[chunk][0], partial[chunk][1]);
+        });
+        for (const std::array<Aabb, 2>& local : partial) {
+            bounds.Grow(local[0]);
+            centroidBounds.Grow(local[1]);
+        }
+    }
+
+    void FillBins(size_t begin, size_t end, const Aabb& centroidBounds, const float* scales, size_t binCount,
+                  BinSet& bins) const {
+        for (size_t i = begin; i < end; ++i) {
+            const BuildPrimitive& primitive = m_primitives[m_indices[i]];
+            for (int axis = 0; axis < 3; ++axis) {
+                if (scales[axis] == 0.0f) {
+                    continue;
+                }
+                Bin& bin = bins[axis][BinIndex(primitive.centroid[axis], centroidBounds.min[axis], scales[axis],
+                                               binCount)];
+                bin.bounds.Grow(primitive.bounds);
+                bin.count++;
+            }
+        }
+    }
+
+    SplitPlane FindSplit(const BuildTask& task, bool parallel) const {
+        const size_t binCount = BinCount(task.count);
+        float scales[3];
+        for (int axis = 0; axis < 3; ++axis) {
+            scales[axis] = BinScale(task.centroidBounds, axis, binCount);
+        }
+
+        BinSet bins;
+        if (parallel) {
+            std::vector<BinSet> partial((task.count + BUILD_CHUNK_SIZE - 1) / BUILD_CHUNK_SIZE);
+            ForEachChunk(task.first, task.count, [&](size_t chunk, size_t begin, size_t end) {
+                FillBins(begin, end, task.centroidBounds, scales, binCount, partial[chunk]);
+            });
+            for (const BinSet& local : partial) {
+                for (int axis = 0; axis < 3; ++axis) {
+                    for (size_t b = 0; b < binCount; ++b) {
+                        bins[axis][b].bounds.Grow(local[axis][b].bounds);
+                        bins[axis][b].count += local[axis][b].count;
+                    }
+                }
+            }
+        } else {
+            FillBins(task.first, task.first + task.count, task.centroidBounds, scales, binCount, bins);
+        }
+
+        SplitPlane best;
+        for (int axis = 0; axis < 3; ++axis) {
+            if (scales[axis] == 0.0f) {
+                continue;
+            }
+            float leftCost[BVH::BIN_COUNT];
+            Aabb running;
+            uint32_t count = 0;
+            for (size_t b = 0; b + 1 < binCount; ++b) {
+                if (bins[axis][b].count > 0) {
+                    running.Grow(bins[axis][b].bounds);
+                    count += bins[axis][b].count;
+                }
+                leftCost[b] = running.Area() * static_cast<float>(count);
+            }
+            running = Aabb();
+            count = 0;
+            for (size_t b = binCount - 1; b > 0; --b) {
+                if (bins[axis][b].count == 0) {
+                    continue;
+                }
+                running.Grow(bins[axis][b].bounds);
+                count += bins[axis][b].count;
+                float cost = leftCost[b - 1] + running.Area() * static_cast<float>(count);
+                if (count < task.count && cost < best.cost) {
+                    best.axis = axis;
+                    best.bin = b - 1;
+                    best.cost = cost;
+                }
+            }
+        }
+        if (best.axis >= 0) {
+            for (size_t b = 0; b < binCount; ++b) {
+                (b <= best.bin ? best.leftBounds : best.rightBounds).Grow(bins[best.axis][b].bounds);
+            }
+        }
+        return best;
+    }
+
+    uint32_t Partition(const BuildTask& task, const SplitPlane& split, Aabb& leftCentroids,
+                       Aabb& rightCentroids) const {
+        const int axis = split.axis;
+        const float offset = task.centroidBounds.min[axis];
+        const size_t binCount = BinCount(task.count);
+        const float scale = BinScale(task.centroidBounds, axis, binCount);
+        uint32_t* left = m_indices.data() + task.first;
+        uint32_t* right = left + task.count;
+        while (left < right) {
+            const float* centroid = m_primitives[*left].centroid;
+            if (BinIndex(centroid[axis], offset, scale, binCount) <= split.bin) {
+                leftCentroids.Grow(centroid);
+                ++left;
+            } else {
+                rightCentroids.Grow(centroid);
+                std::swap(*left, *--right);
+            }
+        }
+        return static_cast<uint32_t>(left - (m_indices.data() + task.first));
+    }
+
+    const std::vector<BuildPrimitive>& m_primitives;
+    std::vector<uint32_t>& m_indices;
+    size_t m_maxLeafTriangles;
+};
+
+float NodeArea(const BVHNode& node) {
+    Aabb bounds;
+    std::copy(node.boundsMin, node.boundsMin + 3, bounds.min);
+    std::copy(node.boundsMax, node.boundsMax + 3, bounds.max);
+    return bounds.Area();
+}
+
+float IntersectNode(const BVHNode& node, const Vector3& origin, const Vector3& inverseDirection,
+                    float tMin, float tMax) {
+    const float* o = &origin.x;
+    const float* inv = &inverseDirection.x;
+    float tNear = tMin;
+    float tFar = tMax;
+    for (int a = 0; a < 3; ++a) {
+        float t0 = (node.boundsMin[a] - o[a]) * inv[a];
+        float t1 = (node.boundsMax[a] - o[a]) * inv[a];
+        if (t0 > t1) {
+            std::swap(t0, t1);
+        }
+        tNear = t0 > tNear ? t0 : tNear;
+        tFar = t1 < tFar ? t1 : tFar;
+    }
+    return tNear <= tFar ? tNear : INF;
+}
+
+bool IntersectTriangle(const BVHTriangle& triangle, const Ray& ray, float tMax, float& t, float& u, float& v) {
+    Vector3 p = ray.direction.Cross(triangle.edge2);
+    float determinant = triangle.edge1.Dot(p);
+    if (std::abs(determinant) < 1e-12f) {
+        return false;
+    }
+    float inverse = 1.0f / determinant;
+    Vector3 s = ray.origin - triangle.v0;
+    u = s.Dot(p) * inverse;
+    if (u < 0.0f || u > 1.0f) {
+        return false;
+    }
+    Vector3 q = s.Cross(triangle.edge1);
+    v = ray.direction.Dot(q) * inverse;
+    if (v < 0.0f || u + v > 1.0f) {
+        return false;
+    }
+    t = triangle.edge2.Dot(q) * inverse;
+    return t >= ray.tMin && t < tMax;
+}
+
+}
+
+BVH BVH::Build(const Mesh& mesh, size_t maxLeafTriangles) {
+    const auto start = std::chrono::steady_clock::now();
+    BVH bvh;
+
+    const size_t vertexCount = mesh.GetVertexCount();
+    const size_t triangleCount = mesh.GetTriangleCount();
+    for (size_t i = 0; i < triangleCount * 3; ++i) {
+        if (mesh.indices[i] >= vertexCount) {
+            return bvh;
+        }
+    }
+    if (triangleCount == 0) {
+        return bvh;
+    }
+
+    Core::ThreadPool& pool = Core::ThreadPool::Global();
+    const size_t chunkCount = (triangleCount + BUILD_CHUNK_SIZE - 1) / BUILD_CHUNK_SIZE;
+    std::vector<BVHTriangle> triangles(triangleCount);
+    std::vector<BuildPrimitive> primitives(triangleCount);
+    pool.ParallelFor(chunkCount, [&](size_t chunk) {
+        size_t end = std::min(triangleCount, (chunk + 1) * BUILD_CHUNK_SIZE);
+        for (size_t t = chunk * BUILD_CHUNK_SIZE; t < end; ++t) {
+            Vector3 p0 = mesh.GetPosition(mesh.indices[t * 3]);
+            Vector3 p1 = mesh.GetPosition(mesh.indices[t * 3 + 1]);
+            Vector3 p2 = mesh.GetPosition(mesh.indices[t * 3 + 2]);
+            triangles[t] = { p0, p1 - p0, p2 - p0 };
+            Vector3 centroid = (p0 + p1 + p2) / 3.0f;
+            BuildPrimitive& primitive = primitives[t];
+            primitive.bounds.Grow(&p0.x);
+            primitive.bounds.Grow(&p1.x);
+            primitive.bounds.Grow(&p2.x);
+            std::copy(&centroid.x, &centroid.x + 3, primitive.centroid);
+        }
+    });
+
+    bvh.m_triangleIndices.resize(triangleCount);
+    std::iota(bvh.m_triangleIndices.begin(), bvh.m_triangleIndices.end(), 0u);
+    BVHBuilder builder(primitives, bvh.m_triangleIndices, std::max<size_t>(maxLeafTriangles, 1));
+
+    std::vector<BVHNode>& nodes = bvh.m_nodes;
+    nodes.reserve(triangleCount * 2);
+    nodes.emplace_back();
+    std::vector<BuildTask> stack = { builder.CreateRoot() };
+    std::vector<BuildTask> subtrees;
+    BuildTask children[2];
+    while (!stack.empty()) {
+        BuildTask task = stack.back();
+        stack.pop_back();
+        if (task.count <= PARALLEL_SPLIT_TRIANGLES) {
+            subtrees.push_back(task);
+        } else if (builder.Process(nodes, task, true, children)) {
+            stack.push_back(children[1]);
+            stack.push_back(children[0]);
+        }
+    }
+
+    std::vector<std::vector<BVHNode>> subtreeNodes(subtrees.size());
+    pool.ParallelFor(subtrees.size(), [&](size_t s) {
+        std::vector<BVHNode>& local = subtreeNodes[s];
+        local.reserve(subtrees[s].count * 2);
+        local.emplace_back();
+        BuildTask root = subtrees[s];
+        root.node = 0;
+        builder.BuildSubtree(local, root);
+    });
+
+    for (size_t s = 0; s < subtrees.size(); ++s) {
+        const std::vector<BVHNode>& local = subtreeNodes[s];
+        const uint32_t base = static_cast<uint32_t>(nodes.size()) - 1;
+        for (size_t i = 0; i < local.size(); ++i) {
+            BVHNode node = local[i];
+            if (!node.IsLeaf()) {
+                node.leftFirst += base;
+            }
+            if (i == 0) {
+                nodes[subtrees[s].node] = node;
+            } else {
+                nodes.push_back(node);
+            }
+        }
+    }
+    nodes.shrink_to_fit();
+
+    bvh.m_triangles.resize(triangleCount);
+    pool.ParallelFor(chunkCount, [&](size_t chunk) {
+        size_t end = std::min(triangleCount, (chunk + 1) * BUILD_CHUNK_SIZE);
+        for (size_t i = chunk * BUILD_CHUNK_SIZE; i < end; ++i) {
+            bvh.m_triangles[i] = triangles[bvh.m_triangleIndices[i]];
+        }
+    });
+
+    BVHStatistics& statistics = bvh.m_statistics;
+    statistics.nodeCount = nodes.size();
+    statistics.nodeMemory = nodes.size() * sizeof(BVHNode);
+    statistics.triangleMemory = bvh.m_triangles.size() * sizeof(BVHTriangle) +
+                                bvh.m_triangleIndices.size() * sizeof(uint32_t);
+
+    const float rootArea = NodeArea(nodes[0]);
+    float weightedCost = 0.0f;
+    std::vector<std::pair<uint32_t, uint32_t>> pending = { { 0u, 0u } };
+    while (!pending.empty()) {
+        std::pair<uint32_t, uint32_t> entry = pending.back();
+        pending.pop_back();
+        const BVHNode& node = nodes[entry.first];
+        statistics.maxDepth = std::max<size_t>(statistics.maxDepth, entry.second);
+        if (node.IsLeaf()) {
+            statistics.leafCount++;
+            statistics.maxLeafTriangles = std::max<size_t>(statistics.maxLeafTriangles, node.triangleCount);
+            weightedCost += NodeArea(node) * INTERSECTION_COST * static_cast<float>(node.triangleCount);
+        } else {
+            weightedCost += NodeArea(node) * TRAVERSAL_COST;
+            pending.push_back({ node.leftFirst, entry.second + 1 });
+            pending.push_back({ node.leftFirst + 1, entry.second + 1 });
+        }
+    }
+    statistics.sahCost = rootArea > 0.0f ? weightedCost / rootArea : 0.0f;
+    statistics.buildMilliseconds =
+        std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+    return bvh;
+}
+
+BoundingBox BVH::GetBounds() const {
+    if (m_nodes.empty()) {
+        return BoundingBox();
+    }
+    const BVHNode& root = m_nodes[0];
+    return BoundingBox(Vector3(root.boundsMin[0], root.boundsMin[1], root.boundsMin[2]),
+                       Vector3(root.boundsMax[0], root.boundsMax[1], root.boundsMax[2]));
+}
+
+bool BVH::Intersect(const Ray& ray, RayHit& hit) const {
+    return Traverse<false>(ray, hit);
+}
+
+bool BVH::Occluded(const Ray& ray) const {
+    RayHit hit;
+    return Traverse<true>(ray, hit);
+}
+
+template <bool AnyHit>
+bool BVH::Traverse(const Ray& ray, RayHit& hit) const {
+    if (m_nodes.empty()) {
+        return false;
+    }
+
+    const Vector3 inverseDirection(1.0f / ray.direction.x, 1.0f / ray.direction.y, 1.0f / ray.direction.z);
+    float tMax = std::min(ray.tMax, hit.distance);
+    if (IntersectNode(m_nodes[0], ray.origin, inverseDirection, ray.tMin, tMax) == INF) {
+        return false;
+    }
+
+    uint32_t stack[MAX_DEPTH];
+    float entries[MAX_DEPTH];
+    size_t stackSize = 0;
+    uint32_t nodeIndex = 0;
+    bool found = false;
+    while (true) {
+        const BVHNode& node = m_nodes[nodeIndex];
+        if (node.IsLeaf()) {
+            for (uint32_t i = node.leftFirst; i < node.leftFirst + node.triangleCount; ++i) {
+                float t, u, v;
+                if (IntersectTriangle(m_triangles[i], ray, tMax, t, u, v)) {
+                    if (AnyHit) {
+                        return true;
+                    }
+                    tMax = t;
+                    hit.distance = t;
+                    hit.triangle = m_triangleIndices[i];
+                    hit.u = u;
+                    hit.v = v;
+                    found = true;
+                }
+            }
+        } else {
+            uint32_t nearChild = node.leftFirst;
+            uint32_t farChild = node.leftFirst + 1;
+            float nearEntry = IntersectNode(m_nodes[nearChild], ray.origin, inverseDirection, ray.tMin, tMax);
+            float farEntry = IntersectNode(m_nodes[farChild], ray.origin, inverseDirection, ray.tMin, tMax);
+            if (farEntry < nearEntry) {
+                std::swap(nearChild, farChild);
+                std::swap(nearEntry, farEntry);
+            }
+            if (nearEntry != INF) {
+                if (farEntry != INF) {
+                    stack[stackSize] = farChild;
+                    entries[stackSize] = farEntry;
+                    stackSize++;
+                }
+                nodeIndex = nearChild;
+                continue;
+            }
+        }
+
+        bool advanced = false;
+        while (stackSize > 0 && !advanced) {
+            stackSize--;
+            if (entries[stackSize] < tMax) {
+                nodeIndex = stack[stackSize];
+                advanced = true;
+            }
+        }
+        if (!advanced) {
+            break;
+        }
+    }
+    return found;
+}
+
+}
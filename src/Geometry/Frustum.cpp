@@ -0,0 +1,323 @@
+#include "Geometry/Frustum.h"
+#include "Math3D/SIMD.h"
+#include <algorithm>
+#include <cmath>
+
+#if defined(TERM3D_X86_SIMD)
+#include <immintrin.h>
+#endif
+
+using Math3D::Matrix4;
+using Math3D::SIMD;
+using Math3D::SIMDLevel;
+using Math3D::Vector3;
+using Math3D::Vector4;
+
+namespace Geometry {
+
+static_assert(sizeof(BoundingBox) == 6 * sizeof(float), "BoundingBox must be tightly packed for batch culling");
+static_assert(sizeof(Vector4) == 4 * sizeof(float), "Vector4 must be tightly packed for batch culling");
+
+namespace {
+
+struct FrustumKernels {
+    void (*cullBoxes)(const float* planes, const BoundingBox* boxes, size_t begin, size_t count, uint32_t* visibility);
+    void (*cullSpheres)(const float* planes, const Vector3* centers, const float* radii,
+                        size_t begin, size_t count, uint32_t* visibility);
+};
+
+bool BoxVisibleScalar(const float* planes, const BoundingBox& box) {
+    float cx = (box.min.x + box.max.x) * 0.5f;
+    float cy = (box.min.y + box.max.y) * 0.5f;
+    float cz = (box.min.z + box.max.z) * 0.5f;
+    float ex = (box.max.x - box.min.x) * 0.5f;
+    float ey = (box.max.y - box.min.y) * 0.5f;
+    float ez = (box.max.z - box.min.z) * 0.5f;
+
+    for (int p = 0; p < Frustum::PLANE_COUNT; ++p) {
+        const float* plane = planes + p * 4;
+        float distance = plane[0] * cx + plane[1] * cy + plane[2] * cz + plane[3];
+        float radius = std::fabs(plane[0]) * ex + std::fabs(plane[1]) * ey + std::fabs(plane[2]) * ez;
+        if (!(distance + radius >= 0.0f)) {
+            return false;
+        }
+    }
+    return true;
+}
+
+bool SphereVisibleScalar(const float* planes, const Vector3& center, float radius) {
+    for (int p = 0; p < Frustum::PLANE_COUNT; ++p) {
+        const float* plane = planes + p * 4;
+        float distance = plane[0] * center.x + plane[1] * center.y + plane[2] * center.z + plane[3];
+        if (!(distance + radius >= 0.0f)) {
+            return false;
+        }
+    }
+    return true;
+}
+
+void CullBoxesScalar(const float* planes, const BoundingBox* boxes, size_t begin, size_t count, uint32_t* visibility) {
+    for (size_t i = begin; i < count; ++i) {
+        if (BoxVisibleScalar(planes, boxes[i])) {
+            visibility[i / 32] |= 1u << (i % 32);
+        }
+    }
+}
+
+void CullSpheresScalar(const float* planes, const Vector3* centers, const float* radii,
+                       size_t begin, size_t count, uint32_t* visibility) {
+    for (size_t i = begin; i < count; ++i) {
+        if (SphereVisibleScalar(planes, centers[i], radii[i])) {
+            visibility[i / 32] |= 1u << (i % 32);
+        }
+    }
+}
+
+#if defined(TERM3D_X86_SIMD)
+
+TERM3D_TARGET_SSE2 inline void DeinterleaveSSE(const float* src, __m128& x, __m128& y, __m128& z) {
+    __m128 v0 = _mm_loadu_ps(src);
+    __m128 v1 = _mm_loadu_ps(src + 4);
+    __m128 v2 = _mm_loadu_ps(src + 8);
+    __m128 xy = _mm_shuffle_ps(v1, v2, _MM_SHUFFLE(2, 1, 3, 2));
+    __m128 yz = _mm_shuffle_ps(v0, v1, _MM_SHUFFLE(1, 0, 2, 1));
+    x = _mm_shuffle_ps(v0, xy, _MM_SHUFFLE(2, 0, 3, 0));
+    y = _mm_shuffle_ps(yz, xy, _MM_SHUFFLE(3, 1, 2, 0));
+    z = _mm_shuffle_ps(yz, v2, _MM_SHUFFLE(3, 0, 3, 1));
+}
+
+TERM3D_TARGET_SSE2 inline int PlaneTestSSE(const float* planes, __m128 cx, __m128 cy, __m128 cz,
+                                           __m128 ex, __m128 ey, __m128 ez) {
+    const __m128 signMask = _mm_set1_ps(-0.0f);
+    const __m128 zero = _mm_setzero_ps();
+    __m128 visible = _mm_cmpeq_ps(zero, zero);
+    for (int p = 0; p < Frustum::PLANE_COUNT; ++p) {
+        __m128 nx = _mm_set1_ps(planes[p * 4]);
+        __m128 ny = _mm_set1_ps(planes[p * 4 + 1]);
+        __m128 nz = _mm_set1_ps(planes[p * 4 + 2]);
+        __m128 d = _mm_set1_ps(planes[p * 4 + 3]);
+        __m128 distance = _mm_add_ps(_mm_add_ps(_mm_add_ps(_mm_mul_ps(nx, cx), _mm_mul_ps(ny, cy)), _mm_mul_ps(nz, cz)), d);
+        __m128 radius = _mm_add_ps(_mm_add_ps(_mm_mul_ps(_mm_andnot_ps(signMask, nx), ex),
+                                              _mm_mul_ps(_mm_andnot_ps(signMask, ny), ey)),
+                                   _mm_mul_ps(_mm_andnot_ps(signMask, nz), ez));
+        visible = _mm_and_ps(visible, _mm_cmpge_ps(_mm_add_ps(distance, radius), zero));
+    }
+    return _mm_movemask_ps(visible);
+}
+
+TERM3D_TARGET_SSE2 void CullBoxesSSE(const float* planes, const BoundingBox* boxes, size_t begin, size_t count, uint32_t* visibility) {
+    const __m128 half = _mm_set1_ps(0.5f);
+    size_t i = begin;
+    for (; i + 4 <= count; i += 4) {
+        const float* src = reinterpret_cast<const float*>(boxes + i);
+        __m128 x01, y01, z01, x23, y23, z23;
+        DeinterleaveSSE(src, x01, y01, z01);
+        DeinterleaveSSE(src + 12, x23, y23, z23);
+
+        __m128 minX = _mm_shuffle_ps(x01, x23, _MM_SHUFFLE(2, 0, 2, 0));
+        __m128 maxX = _mm_shuffle_ps(x01, x23, _MM_SHUFFLE(3, 1, 3, 1));
+        __m128 minY = _mm_shuffle_ps(y01, y23, _MM_SHUFFLE(2, 0, 2, 0));
+        __m128 maxY = _mm_shuffle_ps(y01, y23, _MM_SHUFFLE(3, 1, 3, 1));
+        __m128 minZ = _mm_shuffle_ps(z01, z23, _MM_SHUFFLE(2, 0, 2, 0));
+        __m128 maxZ = _mm_shuffle_ps(z01, z23, _MM_SHUFFLE(3, 1, 3, 1));
+
+        int mask = PlaneTestSSE(planes,
+                                _mm_mul_ps(_mm_add_ps(minX, maxX), half),
+                                _mm_mul_ps(_mm_add_ps(minY, maxY), half),
+                                _mm_mul_ps(_mm_add_ps(minZ, maxZ), half),
+                                _mm_mul_ps(_mm_sub_ps(maxX, minX), half),
+                                _mm_mul_ps(_mm_sub_ps(maxY, minY), half),
+                                _mm_mul_ps(_mm_sub_ps(maxZ, minZ), half));
+        visibility[i / 32] |= static_cast<uint32_t>(mask) << (i % 32);
+    }
+    CullBoxesScalar(planes, boxes, i, count, visibility);
+}
+
+TERM3D_TARGET_SSE2 void CullSpheresSSE(const float* planes, const Vector3* centers, const float* radii,
+                                       size_t begin, size_t count, uint32_t* visibility) {
+    const __m128 zero = _mm_setzero_ps();
+    size_t i = begin;
+    for (; i + 4 <= count; i += 4) {
+        __m128 cx, cy, cz;
+        DeinterleaveSSE(reinterpret_cast<const float*>(centers + i), cx, cy, cz);
+        __m128 radius = _mm_loadu_ps(radii + i);
+
+        __m128 visible = _mm_cmpeq_ps(zero, zero);
+        for (int p = 0; p < Frustum::PLANE_COUNT; ++p) {
+            __m128 distance = _mm_add_ps(_mm_add_ps(_mm_add_ps(_mm_mul_ps(_mm_set1_ps(planes[p * 4]), cx),
+                                                               _mm_mul_ps(_mm_set1_ps(planes[p * 4 + 1]), cy)),
+                                                    _mm_mul_ps(_mm_set1_ps(planes[p * 4 + 2]), cz)),
+                                         _mm_set1_ps(planes[p * 4 + 3]));
+            visible = _mm_and_ps(visible, _mm_cmpge_ps(_mm_add_ps(distance, radius), zero));
+        }
+        visibility[i / 32] |= static_cast<uint32_t>(_mm_movemask_ps(visible)) << (i % 32);
+    }
+    CullSpheresScalar(planes, centers, radii, i, count, visibility);
+}
+
+TERM3D_TARGET_AVX inline void DeinterleaveAVX(const float* src, __m256& x, __m256& y, __m256& z) {
+    __m256 v03 = _mm256_insertf128_ps(_mm256_castps128_ps256(_mm_loadu_ps(src)), _mm_loadu_ps(src + 12), 1);
+    __m256 v14 = _mm256_insertf128_ps(_mm256_castps128_ps256(_mm_loadu_ps(src + 4)), _mm_loadu_ps(src + 16), 1);
+    __m256 v25 = _mm256_insertf128_ps(_mm256_castps128_ps256(_mm_loadu_ps(src + 8)), _mm_loadu_ps(src + 20), 1);
+    __m256 xy = _mm256_shuffle_ps(v14, v25, _MM_SHUFFLE(2, 1, 3, 2));
+    __m256 yz = _mm256_shuffle_ps(v03, v14, _MM_SHUFFLE(1, 0, 2, 1));
+    x = _mm256_shuffle_ps(v03, xy, _MM_SHUFFLE(2, 0, 3, 0));
+    y = _mm256_shuffle_ps(yz, xy, _MM_SHUFFLE(3, 1, 2, 0));
+    z = _mm256_shuffle_ps(yz, v25, _MM_SHUFFLE(3, 0, 3, 1));
+}
+
+TERM3D_TARGET_AVX void CullBoxesAVX(const float* planes, const BoundingBox* boxes, size_t begin, size_t count, uint32_t* visibility) {
+    const __m256 half = _mm256_set1_ps(0.5f);
+    const __m256 signMask = _mm256_set1_ps(-0.0f);
+    const __m256 zero = _mm256_setzero_ps();
+    size_t i = begin;
+    for (; i + 8 <= count; i += 8) {
+        const float* src = reinterpret_cast<const float*>(boxes + i);
+        __m256 xa, ya, za, xb, yb, zb;
+        DeinterleaveAVX(src, xa, ya, za);
+        DeinterleaveAVX(src + 24, xb, yb, zb);
+
+        __m256 minX = _mm256_shuffle_ps(xa, xb, _MM_SHUFFLE(2, 0, 2, 0));
+        __m256 maxX = _mm256_shuffle_ps(xa, xb, _MM_SHUFFLE(3, 1, 3, 1));
+        __m256 minY = _mm256_shuffle_ps(ya, yb, _MM_SHUFFLE(2, 0, 2, 0));
+        __m256 maxY = _mm256_shuffle_ps(ya, yb, _MM_SHUFFLE(3, 1, 3, 1));
+        __m256 minZ = _mm256_shuffle_ps(za, zb, _MM_SHUFFLE(2, 0, 2, 0));
+        __m256 maxZ = _mm256_shuffle_ps(za, zb, _MM_SHUFFLE(3, 1, 3, 1));
+
+        __m256 cx = _mm256_mul_ps(_mm256_add_ps(minX, maxX), half);
+        __m256 cy = _mm256_mul_ps(_mm256_add_ps(minY, maxY), half);
+        __m256 cz = _mm256_mul_ps(_mm256_add_ps(minZ, maxZ), half);
+        __m256 ex = _mm256_mul_ps(_mm256_sub_ps(maxX, minX), half);
+        __m256 ey = _mm256_mul_ps(_mm256_sub_ps(maxY, minY), half);
+        __m256 ez = _mm256_mul_ps(_mm256_sub_ps(maxZ, minZ), half);
+
+        __m256 visible = _mm256_cmp_ps(zero, zero, _CMP_EQ_OQ);
+        for (int p = 0; p < Frustum::PLANE_COUNT; ++p) {
+            __m256 nx = _mm256_set1_ps(planes[p * 4]);
+            __m256 ny = _mm256_set1_ps(planes[p * 4 + 1]);
+            __m256 nz = _mm256_set1_ps(planes[p * 4 + 2]);
+            __m256 d = _mm256_set1_ps(planes[p * 4 + 3]);
+            __m256 distance = _mm256_add_ps(_mm256_add_ps(_mm256_add_ps(_mm256_mul_ps(nx, cx), _mm256_mul_ps(ny, cy)),
+                                                          _mm256_mul_ps(nz, cz)), d);
+            __m256 radius = _mm256_add_ps(_mm256_add_ps(_mm256_mul_ps(_mm256_andnot_ps(signMask, nx), ex),
+                                                        _mm256_mul_ps(_mm256_andnot_ps(signMask, ny), ey)),
+                                          _mm256_mul_ps(_mm256_andnot_ps(signMask, nz), ez));
+            visible = _mm256_and_ps(visible, _mm256_cmp_ps(_mm256_add_ps(distance, radius), zero, _CMP_GE_OQ));
+        }
+
+        uint32_t mask = static_cast<uint32_t>(_mm256_movemask_ps(visible));
+        mask = (mask & 0xC3u) | ((mask & 0x0Cu) << 2) | ((mask & 0x30u) >> 2);
+        visibility[i / 32] |= mask << (i % 32);
+    }
+    CullBoxesSSE(planes, boxes, i, count, visibility);
+}
+
+TERM3D_TARGET_AVX void CullSpheresAVX(const float* planes, const Vector3* centers, const float* radii,
+                                      size_t begin, size_t count, uint32_t* visibility) {
+    const __m256 zero = _mm256_setzero_ps();
+    size_t i = begin;
+    for (; i + 8 <= count; i += 8) {
+        __m256 cx, cy, cz;
+        DeinterleaveAVX(reinterpret_cast<const float*>(centers + i), cx, cy, cz);
+        __m256 radius = _mm256_loadu_ps(radii + i);
+
+        __m256 visible = _mm256_cmp_ps(zero, zero, _CMP_EQ_OQ);
+        for (int p = 0; p < Frustum::PLANE_COUNT; ++p) {
+            __m256 distance = _mm256_add_ps(_mm256_add_ps(_mm256_add_ps(_mm256_mul_ps(_mm256_set1_ps(planes[p * 4]), cx),
+                                                                        _mm256_mul_ps(_mm256_set1_ps(planes[p * 4 + 1]), cy)),
+                                                          _mm256_mul_ps(_mm256_set1_ps(planes[p * 4 + 2]), cz)),
+                                            _mm256_set1_ps(planes[p * 4 + 3]));
+            visible = _mm256_and_ps(visible, _mm256_cmp_ps(_mm256_add_ps(distance, radius), zero, _CMP_GE_OQ));
+        }
+        visibility[i / 32] |= static_cast<uint32_t>(_mm256_movemask_ps(visible)) << (i % 32);
+    }
+    CullSpheresSSE(planes, centers, radii, i, count, visibility);
+}
+
+#endif
+
+FrustumKernels SelectKernels() {
+    FrustumKernels kernels = { CullBoxesScalar, CullSpheresScalar };
+#if defined(TERM3D_X86_SIMD)
+    SIMDLevel level = SIMD::GetLevel();
+    if (level >= SIMDLevel::AVX) {
+        kernels = { CullBoxesAVX, CullSpheresAVX };
+    } else if (level >= SIMDLevel::SSE2) {
+        kernels = { CullBoxesSSE, CullSpheresSSE };
+    }
+#endif
+    return kernels;
+}
+
+const FrustumKernels& GetKernels() {
+    static const FrustumKernels kernels = SelectKernels();
+    return kernels;
+}
+
+size_t CountVisible(const uint32_t* visibility, size_t count) {
+    size_t visible = 0;
+    for (size_t word = 0; word < Frustum::GetMaskWordCount(count); ++word) {
+        for (uint32_t bits = visibility[word]; bits != 0; bits &= bits - 1) {
+            ++visible;
+        }
+    }
+    return visible;
+}
+
+}
+
+Frustum::Frustum() {
+    Extract(Matrix4::Identity());
+}
+
+Frustum::Frustum(const Matrix4& viewProjection) {
+    Extract(viewProjection);
+}
+
+void Frustum::Extract(const Matrix4& viewProjection) {
+    const Matrix4& m = viewProjection;
+    Vector4 row0(m(0, 0), m(0, 1), m(0, 2), m(0, 3));
+    Vector4 row1(m(1, 0), m(1, 1), m(1, 2), m(1, 3));
+    Vector4 row2(m(2, 0), m(2, 1), m(2, 2), m(2, 3));
+    Vector4 row3(m(3, 0), m(3, 1), m(3, 2), m(3, 3));
+
+    m_planes[static_cast<int>(FrustumPlane::Left)] = row3 + row0;
+    m_planes[static_cast<int>(FrustumPlane::Right)] = row3 - row0;
+    m_planes[static_cast<int>(FrustumPlane::Bottom)] = row3 + row1;
+    m_planes[static_cast<int>(FrustumPlane::Top)] = row3 - row1;
+    m_planes[static_cast<int>(FrustumPlane::Near)] = row3 + row2;
+    m_planes[static_cast<int>(FrustumPlane::Far)] = row3 - row2;
+
+    for (Vector4& plane : m_planes) {
+        float length = plane.XYZ().Length();
+        if (length > 0.0f) {
+            plane = plane * (1.0f / length);
+        }
+    }
+}
+
+bool Frustum::ContainsPoint(const Vector3& point) const {
+    return SphereVisibleScalar(&m_planes[0].x, point, 0.0f);
+}
+
+bool Frustum::IntersectsSphere(const Vector3& center, float radius) const {
+    return SphereVisibleScalar(&m_planes[0].x, center, radius);
+}
+
+bool Frustum::IntersectsBox(const BoundingBox& box) const {
+    return BoxVisibleScalar(&m_planes[0].x, box);
+}
+
+size_t Frustum::CullBoxes(const BoundingBox* boxes, size_t count, uint32_t* visibility) const {
+    std::fill(visibility, visibility + GetMaskWordCount(count), 0u);
+    GetKernels().cullBoxes(&m_planes[0].x, boxes, 0, count, visibility);
+    return CountVisible(visibility, count);
+}
+
+size_t Frustum::CullSpheres(const Vector3* centers, const float* radii, size_t count, uint32_t* visibility) const {
+    std::fill(visibility, visibility + GetMaskWordCount(count), 0u);
+    GetKernels().cullSpheres(&m_planes[0].x, centers, radii, 0, count, visibility);
+    return CountVisible(visibility, count);
+}
+
+}
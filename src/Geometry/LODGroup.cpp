@@ -0,0 +1,132 @@
+#include "Geometry/LODGroup.h"
+#include "Math3D/MathUtils.h"
+#include "Math3D/Vector4.h"
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <utility>
+
+using Math3D::Matrix4;
+using Math3D::Vector3;
+
+namespace Geometry {
+
+LODGroup::LODGroup(std::vector<MeshLOD> levels) : m_levels(std::move(levels)) {
+    std::stable_sort(m_levels.begin(), m_levels.end(),
+                     [](const MeshLOD& a, const MeshLOD& b) { return a.error < b.error; });
+}
+
+LODGroup LODGroup::Create(const Mesh& mesh, const std::vector<float>& ratios) {
+    std::vector<MeshLOD> levels = mesh.GenerateLODs(ratios);
+    if (levels.empty() || levels.front().ratio < 1.0f) {
+        MeshLOD source;
+        source.mesh = mesh;
+        levels.insert(levels.begin(), source);
+    }
+    return LODGroup(std::move(levels));
+}
+
+void LODGroup::AddLevel(const Mesh& mesh, float error) {
+    MeshLOD level;
+    level.mesh = mesh;
+    level.error = std::max(error, 0.0f);
+    auto position = std::upper_bound(m_levels.begin(), m_levels.end(), level.error,
+                                     [](float value, const MeshLOD& other) { return value < other.error; });
+    m_levels.insert(position, level);
+
+    const size_t sourceTriangles = m_levels.front().mesh.GetTriangleCount();
+    for (MeshLOD& lod : m_levels) {
+        lod.ratio = sourceTriangles > 0
+            ? static_cast<float>(lod.mesh.GetTriangleCount()) / static_cast<float>(sourceTriangles)
+            : 0.0f;
+    }
+}
+
+void LODGroup::Clear() {
+    m_levels.clear();
+    m_currentLevel = 0;
+}
+
+const BoundingBox& LODGroup::GetBounds() const {
+    static const BoundingBox empty;
+    return m_levels.empty() ? empty : m_levels.front().mesh.bounds;
+}
+
+const MeshLOD& LODGroup::GetCurrentMesh() const {
+    static const MeshLOD empty;
+    return m_levels.empty() ? empty : m_levels[std::min(m_currentLevel, m_levels.size() - 1)];
+}
+
+void LODGroup::SetErrorThreshold(float pixels) {
+    m_errorThreshold = std::max(pixels, 0.0f);
+}
+
+void LODGroup::SetHysteresis(float hysteresis) {
+    m_hysteresis = Math3D::MathUtils::Clamp(hysteresis, 0.0f, 1.0f);
+}
+
+float LODGroup::GetProjectionScale(const Matrix4& projection, const Matrix4& modelView, float viewportHeight) const {
+    if (m_levels.empty() || !GetBounds().IsValid()) {
+        return 0.0f;
+    }
+
+    float objectScale = 0.0f;
+    for (int col = 0; col < 3; ++col) {
+        Vector3 axis(modelView(0, col), modelView(1, col), modelView(2, col));
+        objectScale = std::max(objectScale, axis.Length());
+    }
+    const float pixelsPerUnit = objectScale * projection(1, 1) * viewportHeight * 0.5f;
+
+    const bool perspective = projection(3, 2) != 0.0f;
+    if (!perspective) {
+        return pixelsPerUnit;
+    }
+
+    const BoundingBox& bounds = GetBounds();
+    Math3D::Vector4 center = modelView * Math3D::Vector4(bounds.GetCenter(), 1.0f);
+    float distance = -center.z - bounds.GetRadius() * objectScale;
+    if (distance <= Math3D::MathUtils::EPSILON) {
+        return std::numeric_limits<float>::infinity();
+    }
+    return pixelsPerUnit / distance;
+}
+
+float LODGroup::GetScreenSpaceError(size_t level, const Matrix4& projection, const Matrix4& modelView,
+                                    float viewportHeight) const {
+    float error = m_levels[level].error;
+    if (error <= 0.0f) {
+        return 0.0f;
+    }
+    return error * GetProjectionScale(projection, modelView, viewportHeight);
+}
+
+size_t LODGroup::SelectLevel(const Matrix4& projection, const Matrix4& modelView, float viewportHeight) {
+    if (m_levels.empty()) {
+        return 0;
+    }
+
+    const float scale = GetProjectionScale(projection, modelView, viewportHeight);
+    if (!std::isfinite(scale) || scale <= 0.0f) {
+        m_currentLevel = 0;
+        return m_currentLevel;
+    }
+    auto coarsestWithin = [&](float threshold) {
+        const float maxError = threshold / scale;
+        size_t level = 0;
+        while (level + 1 < m_levels.size() && m_levels[level + 1].error <= maxError) {
+            level++;
+        }
+        return level;
+    };
+
+    m_currentLevel = std::min(m_currentLevel, m_levels.size() - 1);
+    const size_t allowed = coarsestWithin(m_errorThreshold);
+    if (m_currentLevel > allowed) {
+        m_currentLevel = allowed;
+    } else {
+        m_currentLevel = std::max(m_currentLevel, coarsestWithin(m_errorThreshold * (1.0f - m_hysteresis)));
+    }
+    return m_currentLevel;
+}
+
+}
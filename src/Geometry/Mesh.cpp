@@ -11,6 +11,11 @@ Mesh::Mesh(const std::vector<Vertex>& vertices, const std::vector<uint32_t>& ind
 }
 
 void Mesh::CalculateNormals() {
+    if (m_layout == VertexLayout::Streams) {
+        CalculateStreamNormals();
+        return;
+    }
+    
     for (auto& vertex : vertices) {
         vertex.normal = Math3D::Vector3::Zero;
     }
@@ -43,6 +48,11 @@ void Mesh::CalculateNormals() {
 }
 
 void Mesh::CalculateTangents() {
+    if (m_layout == VertexLayout::Streams) {
+        CalculateStreamTangents();
+        return;
+    }
+    
     for (auto& vertex : vertices) {
         vertex.tangent = Math3D::Vector3::Zero;
         vertex.bitangent = Math3D::Vector3::Zero;
@@ -95,6 +105,16 @@ void Mesh::CalculateTangents() {
 }
 
 void Mesh::UpdateBounds() {
+    if (m_layout == VertexLayout::Streams) {
+        Math3D::Vector3 min, max;
+        if (streams.positions.MinMax(min, max)) {
+            bounds = BoundingBox(min, max);
+        } else {
+            bounds.Reset();
+        }
+        return;
+    }
+    
     bounds.Reset();
     for (const auto& vertex : vertices) {
         bounds.Expand(vertex.position);
@@ -103,26 +123,148 @@ void Mesh::UpdateBounds() {
 
 void Mesh::Clear() {
     vertices.clear();
+    streams.Clear();
     indices.clear();
     bounds.Reset();
 }
 
 bool Mesh::IsValid() const {
-    return !vertices.empty() && 
+    return GetVertexCount() > 0 && 
            (indices.empty() || (indices.size() % 3 == 0));
 }
 
+void Mesh::SetLayout(VertexLayout layout) {
+    if (layout == m_layout) {
+        return;
+    }
+    
+    if (layout == VertexLayout::Streams) {
+        streams.Assign(vertices.data(), vertices.size());
+        std::vector<Vertex>().swap(vertices);
+    } else {
+        vertices.resize(streams.Size());
+        streams.CopyTo(vertices.data());
+        streams = VertexStreams();
+    }
+    m_layout = layout;
+}
+
+Vertex Mesh::GetVertex(size_t index) const {
+    return m_layout == VertexLayout::Streams ? streams.Get(index) : vertices[index];
+}
+
+Math3D::Vector3 Mesh::GetPosition(size_t index) const {
+    return m_layout == VertexLayout::Streams ? streams.positions.Get(index) : vertices[index].position;
+}
+
+void Mesh::CopyVerticesTo(std::vector<Vertex>& out) const {
+    if (m_layout == VertexLayout::Streams) {
+        out.resize(streams.Size());
+        streams.CopyTo(out.data());
+    } else {
+        out = vertices;
+    }
+}
+
+void Mesh::CalculateStreamNormals() {
+    const size_t vertexCount = streams.Size();
+    streams.normals.Clear();
+    streams.normals.Resize(vertexCount);
+    
+    const float* px = streams.positions.X();
+    const float* py = streams.positions.Y();
+    const float* pz = streams.positions.Z();
+    float* nx = streams.normals.X();
+    float* ny = streams.normals.Y();
+    float* nz = streams.normals.Z();
+    
+    for (size_t i = 0; i + 2 < indices.size(); i += 3) {
+        uint32_t i0 = indices[i];
+        uint32_t i1 = indices[i + 1];
+        uint32_t i2 = indices[i + 2];
+        
+        if (i0 >= vertexCount || i1 >= vertexCount || i2 >= vertexCount) {
+            continue;
+        }
+        
+        float e1x = px[i1] - px[i0], e1y = py[i1] - py[i0], e1z = pz[i1] - pz[i0];
+        float e2x = px[i2] - px[i0], e2y = py[i2] - py[i0], e2z = pz[i2] - pz[i0];
+        float cx = e1y * e2z - e1z * e2y;
+        float cy = e1z * e2x - e1x * e2z;
+        float cz = e1x * e2y - e1y * e2x;
+        
+        nx[i0] += cx; ny[i0] += cy; nz[i0] += cz;
+        nx[i1] += cx; ny[i1] += cy; nz[i1] += cz;
+        nx[i2] += cx; ny[i2] += cy; nz[i2] += cz;
+    }
+    
+    streams.normals.Normalize();
+}
+
+void Mesh::CalculateStreamTangents() {
+    const size_t vertexCount = streams.Size();
+    streams.tangents.Clear();
+    streams.tangents.Resize(vertexCount);
+    streams.bitangents.Clear();
+    streams.bitangents.Resize(vertexCount);
+    
+    for (size_t i = 0; i + 2 < indices.size(); i += 3) {
+        uint32_t i0 = indices[i];
+        uint32_t i1 = indices[i + 1];
+        uint32_t i2 = indices[i + 2];
+        
+        if (i0 >= vertexCount || i1 >= vertexCount || i2 >= vertexCount) {
+            continue;
+        }
+        
+        Math3D::Vector3 p0 = streams.positions.Get(i0);
+        Math3D::Vector3 edge1 = streams.positions.Get(i1) - p0;
+        Math3D::Vector3 edge2 = streams.positions.Get(i2) - p0;
+        
+        Math3D::Vector2 deltaUV1 = streams.texCoords[i1] - streams.texCoords[i0];
+        Math3D::Vector2 deltaUV2 = streams.texCoords[i2] - streams.texCoords[i0];
+        
+        float f = 1.0f / (deltaUV1.x * deltaUV2.y - deltaUV2.x * deltaUV1.y);
+        
+        Math3D::Vector3 tangent = ((edge1 * deltaUV2.y - edge2 * deltaUV1.y) * f).Normalized();
+        Math3D::Vector3 bitangent = ((edge2 * deltaUV1.x - edge1 * deltaUV2.x) * f).Normalized();
+        
+        for (uint32_t index : { i0, i1, i2 }) {
+            streams.tangents.Set(index, streams.tangents.Get(index) + tangent);
+            streams.bitangents.Set(index, streams.bitangents.Get(index) + bitangent);
+        }
+    }
+    
+    for (size_t i = 0; i < vertexCount; ++i) {
+        Math3D::Vector3 normal = streams.normals.Get(i);
+        Math3D::Vector3 tangent = streams.tangents.Get(i);
+        tangent = (tangent - normal * normal.Dot(tangent)).Normalized();
+        streams.tangents.Set(i, tangent);
+        streams.bitangents.Set(i, normal.Cross(tangent).Normalized());
+    }
+}
 
-Math3D::Matrix3 ExtractRotationMatrix(const Math3D::Matrix4& transform) {
-    Math3D::Matrix3 rotation;
-    rotation(0, 0) = transform(0, 0); rotation(0, 1) = transform(0, 1); rotation(0, 2) = transform(0, 2);
-    rotation(1, 0) = transform(1, 0); rotation(1, 1) = transform(1, 1); rotation(1, 2) = transform(1, 2);
-    rotation(2, 0) = transform(2, 0); rotation(2, 1) = transform(2, 1); rotation(2, 2) = transform(2, 2);
-    return rotation;
+void Mesh::TransformStreams(const Math3D::Matrix4& transform) {
+    Math3D::Matrix3 linear = transform.GetUpper3x3();
+    
+    streams.positions.TransformPoints(transform);
+    streams.normals.TransformDirections(linear.InverseTranspose());
+    streams.normals.Normalize();
+    streams.tangents.TransformDirections(linear);
+    streams.tangents.Normalize();
+    streams.bitangents.TransformDirections(linear);
+    streams.bitangents.Normalize();
 }
 
 void Mesh::Transform(const Math3D::Matrix4& transform) {
-    Math3D::Matrix3 normalMatrix = ExtractRotationMatrix(transform).Transposed();
+    if (m_layout == VertexLayout::Streams) {
+        TransformStreams(transform);
+        UpdateBounds();
+        return;
+    }
+    
+    Math3D::Matrix3 linear = transform.GetUpper3x3();
+    Math3D::Matrix3 normalMatrix = linear.InverseTranspose();
     
     for (auto& vertex : vertices) {
         Math3D::Vector4 pos(vertex.position, 1.0f);
@@ -130,8 +272,8 @@ void Mesh::Transform(const Math3D::Matrix4& transform) {
         vertex.position = pos.XYZ();
         
         vertex.normal = (normalMatrix * vertex.normal).Normalized();
-        vertex.tangent = (normalMatrix * vertex.tangent).Normalized();
-        vertex.bitangent = (normalMatrix * vertex.bitangent).Normalized();
+        vertex.tangent = (linear * vertex.tangent).Normalized();
+        vertex.bitangent = (linear * vertex.bitangent).Normalized();
     }
     
     UpdateBounds();
@@ -231,31 +373,32 @@ Mesh Mesh::CreateSphere(float radius, uint32_t segments) {
     Mesh mesh;
     segments = std::max(segments, 3u);
     
+    std::vector<float> sinTheta(segments + 1), cosTheta(segments + 1);
+    std::vector<float> sinPhi(segments + 1), cosPhi(segments + 1);
+    Math3D::MathUtils::SinCosRing(0.0f, Math3D::MathUtils::PI / segments, segments + 1, sinTheta.data(), cosTheta.data());
+    Math3D::MathUtils::SinCosRing(0.0f, Math3D::MathUtils::PI * 2.0f / segments, segments + 1, sinPhi.data(), cosPhi.data());
+    
+    mesh.vertices.reserve(static_cast<size_t>(segments + 1) * (segments + 1));
+    mesh.indices.reserve(static_cast<size_t>(segments) * segments * 6);
+    
     for (uint32_t y = 0; y <= segments; ++y) {
         float v = static_cast<float>(y) / segments;
-        float theta = v * Math3D::MathUtils::PI;
         
         for (uint32_t x = 0; x <= segments; ++x) {
             float u = static_cast<float>(x) / segments;
-            float phi = u * Math3D::MathUtils::PI * 2.0f;
-            
-            float sinTheta = std::sin(theta);
-            float cosTheta = std::cos(theta);
-            float sinPhi = std::sin(phi);
-            float cosPhi = std::cos(phi);
             
             Math3D::Vector3 position(
-                radius * sinTheta * cosPhi,
-                radius * cosTheta,
-                radius * sinTheta * sinPhi
+                radius * sinTheta[y] * cosPhi[x],
+                radius * cosTheta[y],
+                radius * sinTheta[y] * sinPhi[x]
             );
             
             Math3D::Vector3 normal = position.Normalized();
             
             Math3D::Vector3 tangent(
-                -radius * sinTheta * sinPhi,
+                -radius * sinTheta[y] * sinPhi[x],
                 0.0f,
-                radius * sinTheta * cosPhi
+                radius * sinTheta[y] * cosPhi[x]
             );
             tangent.Normalize();
             
@@ -309,16 +452,18 @@ Mesh Mesh::CreateCylinder(float radius, float height, uint32_t segments) {
     segments = std::max(segments, 3u);
     float halfHeight = height * 0.5f;
     
+    std::vector<float> ringSin(segments + 1), ringCos(segments + 1);
+    Math3D::MathUtils::SinCosRing(0.0f, Math3D::MathUtils::PI * 2.0f / segments, segments + 1, ringSin.data(), ringCos.data());
+    
     for (uint32_t i = 0; i <= segments; ++i) {
-        float angle = (static_cast<float>(i) / segments) * Math3D::MathUtils::PI * 2.0f;
-        float x = std::cos(angle) * radius;
-        float z = std::sin(angle) * radius;
+        float x = ringCos[i] * radius;
+        float z = ringSin[i] * radius;
         float u = static_cast<float>(i) / segments;
         
         Math3D::Vector3 normal(x, 0.0f, z);
         normal.Normalize();
         
-        Math3D::Vector3 tangent(-std::sin(angle), 0.0f, std::cos(angle));
+        Math3D::Vector3 tangent(-ringSin[i], 0.0f, ringCos[i]);
         tangent.Normalize();
         
         Math3D::Vector3 bitangent(0.0f, 1.0f, 0.0f);
@@ -365,11 +510,10 @@ Mesh Mesh::CreateCylinder(float radius, float height, uint32_t segments) {
     ));
     
     for (uint32_t i = 0; i <= segments; ++i) {
-        float angle = (static_cast<float>(i) / segments) * Math3D::MathUtils::PI * 2.0f;
-        float x = std::cos(angle) * radius;
-        float z = std::sin(angle) * radius;
-        float u = (std::cos(angle) + 1.0f) * 0.5f;
-        float v = (std::sin(angle) + 1.0f) * 0.5f;
+        float x = ringCos[i] * radius;
+        float z = ringSin[i] * radius;
+        float u = (ringCos[i] + 1.0f) * 0.5f;
+        float v = (ringSin[i] + 1.0f) * 0.5f;
         
         mesh.vertices.push_back(Vertex(
             Math3D::Vector3(x, halfHeight, z),
@@ -396,11 +540,10 @@ Mesh Mesh::CreateCylinder(float radius, float height, uint32_t segments) {
     ));
     
     for (uint32_t i = 0; i <= segments; ++i) {
-        float angle = (static_cast<float>(i) / segments) * Math3D::MathUtils::PI * 2.0f;
-        float x = std::cos(angle) * radius;
-        float z = std::sin(angle) * radius;
-        float u = (std::cos(angle) + 1.0f) * 0.5f;
-        float v = (std::sin(angle) + 1.0f) * 0.5f;
+        float x = ringCos[i] * radius;
+        float z = ringSin[i] * radius;
+        float u = (ringCos[i] + 1.0f) * 0.5f;
+        float v = (ringSin[i] + 1.0f) * 0.5f;
         
         mesh.vertices.push_back(Vertex(
             Math3D::Vector3(x, -halfHeight, z),
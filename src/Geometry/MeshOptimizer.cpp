@@ -0,0 +1,649 @@
+#include "Geometry/Mesh.h"
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <limits>
+
+namespace Geometry {
+
+namespace {
+
+const size_t SCORING_CACHE_SIZE = 32;
+const size_t MAX_SCORED_VALENCE = 32;
+const float CACHE_DECAY_POWER = 1.5f;
+const float LAST_TRIANGLE_SCORE = 0.75f;
+const float VALENCE_BOOST_SCALE = 2.0f;
+const float VALENCE_BOOST_POWER = 0.5f;
+const size_t CLUSTER_CACHE_SIZE = 16;
+const int OVERDRAW_GRID_SIZE = 256;
+const uint32_t REMOVED_VERTEX = UINT32_MAX;
+
+class VertexScoreTable {
+public:
+    VertexScoreTable() {
+        for (size_t position = 0; position < SCORING_CACHE_SIZE; ++position) {
+            if (position < 3) {
+                m_cache[position] = LAST_TRIANGLE_SCORE;
+            } else {
+                float scaler = 1.0f / static_cast<float>(SCORING_CACHE_SIZE - 3);
+                m_cache[position] = std::pow(1.0f - static_cast<float>(position - 3) * scaler, CACHE_DECAY_POWER);
+            }
+        }
+        m_valence[0] = 0.0f;
+        for (size_t valence = 1; valence <= MAX_SCORED_VALENCE; ++valence) {
+            m_valence[valence] = VALENCE_BOOST_SCALE * std::pow(static_cast<float>(valence), -VALENCE_BOOST_POWER);
+        }
+    }
+
+    float Score(int cachePosition, uint32_t remainingTriangles) const {
+        if (remainingTriangles == 0) {
+            return -1.0f;
+        }
+        float score = cachePosition >= 0 ? m_cache[cachePosition] : 0.0f;
+        return score + m_valence[std::min<size_t>(remainingTriangles, MAX_SCORED_VALENCE)];
+    }
+
+private:
+    float m_cache[SCORING_CACHE_SIZE];
+    float m_valence[MAX_SCORED_VALENCE + 1];
+};
+
+const VertexScoreTable& GetScoreTable() {
+    static const VertexScoreTable table;
+    return table;
+}
+
+void OptimizeTriangleOrder(const uint32_t* indices, size_t triangleCount, size_t vertexCount,
+                           std::vector<uint32_t>& order) {
+    const VertexScoreTable& table = GetScoreTable();
+
+    std::vector<uint32_t> adjacencyOffsets(vertexCount + 1, 0);
+    for (size_t i = 0; i < triangleCount * 3; ++i) {
+        adjacencyOffsets[indices[i] + 1]++;
+    }
+    for (size_t v = 0; v < vertexCount; ++v) {
+        adjacencyOffsets[v + 1] += adjacencyOffsets[v];
+    }
+
+    std::vector<uint32_t> remaining(vertexCount, 0);
+    std::vector<uint32_t> adjacency(triangleCount * 3);
+    for (size_t t = 0; t < triangleCount; ++t) {
+        for (int k = 0; k < 3; ++k) {
+            uint32_t vertex = indices[t * 3 + k];
+            adjacency[adjacencyOffsets[vertex] + remaining[vertex]++] = static_cast<uint32_t>(t);
+        }
+    }
+
+    std::vector<int> cachePositions(vertexCount, -1);
+    std::vector<float> vertexScores(vertexCount);
+    for (size_t v = 0; v < vertexCount; ++v) {
+        vertexScores[v] = table.Score(-1, remaining[v]);
+    }
+
+    std::vector<float> triangleScores(triangleCount);
+    std::vector<bool> emitted(triangleCount, false);
+    for (size_t t = 0; t < triangleCount; ++t) {
+        triangleScores[t] = vertexScores[indices[t * 3]] + vertexScores[indices[t * 3 + 1]] +
+                            vertexScores[indices[t * 3 + 2]];
+    }
+
+    std::vector<uint32_t> cache;
+    std::vector<uint32_t> nextCache;
+    cache.reserve(SCORING_CACHE_SIZE + 3);
+    nextCache.reserve(SCORING_CACHE_SIZE + 3);
+
+    order.clear();
+    order.reserve(triangleCount);
+
+    auto rescore = [&](uint32_t vertex) {
+        float score = table.Score(cachePositions[vertex], remaining[vertex]);
+        float delta = score - vertexScores[vertex];
+        vertexScores[vertex] = score;
+        for (uint32_t a = 0; a < remaining[vertex]; ++a) {
+            triangleScores[adjacency[adjacencyOffsets[vertex] + a]] += delta;
+        }
+    };
+
+    size_t deadEndCursor = 0;
+    size_t best = triangleCount == 0 ? 0 : static_cast<size_t>(
+        std::max_element(triangleScores.begin(), triangleScores.end()) - triangleScores.begin());
+
+    while (order.size() < triangleCount) {
+        if (best >= triangleCount) {
+            while (emitted[deadEndCursor]) {
+                deadEndCursor++;
+            }
+            best = deadEndCursor;
+        }
+
+        order.push_back(static_cast<uint32_t>(best));
+        emitted[best] = true;
+
+        const uint32_t* triangle = indices + best * 3;
+        nextCache.assign(triangle, triangle + 3);
+        for (int k = 0; k < 3; ++k) {
+            uint32_t vertex = triangle[k];
+            uint32_t* begin = adjacency.data() + adjacencyOffsets[vertex];
+            uint32_t* end = begin + remaining[vertex];
+            *std::find(begin, end, static_cast<uint32_t>(best)) = *(end - 1);
+            remaining[vertex]--;
+        }
+        for (uint32_t vertex : cache) {
+            if (vertex != triangle[0] && vertex != triangle[1] && vertex != triangle[2]) {
+                nextCache.push_back(vertex);
+            }
+        }
+
+        for (size_t position = SCORING_CACHE_SIZE; position < nextCache.size(); ++position) {
+            cachePositions[nextCache[position]] = -1;
+            rescore(nextCache[position]);
+        }
+        if (nextCache.size() > SCORING_CACHE_SIZE) {
+            nextCache.resize(SCORING_CACHE_SIZE);
+        }
+        cache.swap(nextCache);
+
+        for (size_t position = 0; position < cache.size(); ++position) {
+            cachePositions[cache[position]] = static_cast<int>(position);
+            rescore(cache[position]);
+        }
+
+        best = triangleCount;
+        float bestScore = -1.0f;
+        for (uint32_t vertex : cache) {
+            for (uint32_t a = 0; a < remaining[vertex]; ++a) {
+                uint32_t adjacent = adjacency[adjacencyOffsets[vertex] + a];
+                if (triangleScores[adjacent] > bestScore) {
+                    bestScore = triangleScores[adjacent];
+                    best = adjacent;
+                }
+            }
+        }
+    }
+}
+
+
+class FifoCache {
+public:
+    explicit FifoCache(size_t size) : m_entries(size, UINT32_MAX) {}
+
+    void Reset() {
+        std::fill(m_entries.begin(), m_entries.end(), UINT32_MAX);
+        m_head = 0;
+    }
+
+    int Touch(const uint32_t* triangle) {
+        int misses = 0;
+        for (int k = 0; k < 3; ++k) {
+            if (std::find(m_entries.begin(), m_entries.end(), triangle[k]) == m_entries.end()) {
+                m_entries[m_head] = triangle[k];
+                m_head = (m_head + 1) % m_entries.size();
+                misses++;
+            }
+        }
+        return misses;
+    }
+
+private:
+    std::vector<uint32_t> m_entries;
+    size_t m_head = 0;
+};
+
+void GenerateClusters(const uint32_t* indices, size_t triangleCount, float threshold, std::vector<size_t>& clusters) {
+    FifoCache cache(CLUSTER_CACHE_SIZE);
+    std::vector<size_t> hardBoundaries;
+    std::vector<int> misses(triangleCount);
+    for (size_t t = 0; t < triangleCount; ++t) {
+        misses[t] = cache.Touch(indices + t * 3);
+        if (t == 0 || misses[t] == 3) {
+            hardBoundaries.push_back(t);
+        }
+    }
+    hardBoundaries.push_back(triangleCount);
+
+    clusters.clear();
+    for (size_t h = 0; h + 1 < hardBoundaries.size(); ++h) {
+        size_t begin = hardBoundaries[h];
+        size_t end = hardBoundaries[h + 1];
+
+        size_t clusterMisses = 0;
+        for (size_t t = begin; t < end; ++t) {
+            clusterMisses += static_cast<size_t>(misses[t]);
+        }
+        float clusterThreshold = threshold * static_cast<float>(clusterMisses) / static_cast<float>(end - begin);
+
+        clusters.push_back(begin);
+        cache.Reset();
+        size_t runningMisses = 0;
+        size_t runningTriangles = 0;
+        for (size_t t = begin; t < end; ++t) {
+            runningMisses += static_cast<size_t>(cache.Touch(indices + t * 3));
+            runningTriangles++;
+            if (t + 1 < end &&
+                static_cast<float>(runningMisses) / static_cast<float>(runningTriangles) <= clusterThreshold) {
+                clusters.push_back(t + 1);
+                cache.Reset();
+                runningMisses = 0;
+                runningTriangles = 0;
+            }
+        }
+    }
+    clusters.push_back(triangleCount);
+}
+
+struct CellKey {
+    int64_t x, y, z;
+
+    bool operator==(const CellKey& other) const { return x == other.x && y == other.y && z == other.z; }
+};
+
+class SpatialHash {
+public:
+    explicit SpatialHash(size_t capacity) {
+        size_t size = 16;
+        while (size < capacity * 2) {
+            size <<= 1;
+        }
+        m_keys.resize(size);
+        m_heads.assign(size, REMOVED_VERTEX);
+        m_mask = size - 1;
+    }
+
+    uint32_t Find(const CellKey& key) const {
+        for (size_t slot = Hash(key) & m_mask;; slot = (slot + 1) & m_mask) {
+            if (m_heads[slot] == REMOVED_VERTEX) {
+                return REMOVED_VERTEX;
+            }
+            if (m_keys[slot] == key) {
+                return m_heads[slot];
+            }
+        }
+    }
+
+    uint32_t& Head(const CellKey& key) {
+        for (size_t slot = Hash(key) & m_mask;; slot = (slot + 1) & m_mask) {
+            if (m_heads[slot] == REMOVED_VERTEX) {
+                m_keys[slot] = key;
+                return m_heads[slot];
+            }
+            if (m_keys[slot] == key) {
+                return m_heads[slot];
+            }
+        }
+    }
+
+private:
+    static size_t Hash(const CellKey& key) {
+        uint64_t hash = static_cast<uint64_t>(key.x) * 73856093ull;
+        hash ^= static_cast<uint64_t>(key.y) * 19349663ull;
+        hash ^= static_cast<uint64_t>(key.z) * 83492791ull;
+        return static_cast<size_t>(hash ^ (hash >> 29));
+    }
+
+    std::vector<CellKey> m_keys;
+    std::vector<uint32_t> m_heads;
+    size_t m_mask = 0;
+};
+
+const double MAX_CELL_COORDINATE = 1e15;
+
+int64_t CellCoordinate(float value, double invCellSize) {
+    return static_cast<int64_t>(std::floor(static_cast<double>(value) * invCellSize));
+}
+
+bool WithinTolerance(const Math3D::Vector3& a, const Math3D::Vector3& b, float tolerance) {
+    return std::fabs(a.x - b.x) <= tolerance && std::fabs(a.y - b.y) <= tolerance && std::fabs(a.z - b.z) <= tolerance;
+}
+
+bool CanWeld(const Vertex& a, const Vertex& b, float epsilon, VertexAttribute attributes, float attributeEpsilon) {
+    return WithinTolerance(a.position, b.position, epsilon) &&
+           (!HasAttribute(attributes, VertexAttribute::Normal) ||
+            WithinTolerance(a.normal, b.normal, attributeEpsilon)) &&
+           (!HasAttribute(attributes, VertexAttribute::Tangent) ||
+            WithinTolerance(a.tangent, b.tangent, attributeEpsilon)) &&
+           (!HasAttribute(attributes, VertexAttribute::Bitangent) ||
+            WithinTolerance(a.bitangent, b.bitangent, attributeEpsilon)) &&
+           (!HasAttribute(attributes, VertexAttribute::TexCoord) ||
+            (std::fabs(a.texCoord.x - b.texCoord.x) <= attributeEpsilon &&
+             std::fabs(a.texCoord.y - b.texCoord.y) <= attributeEpsilon));
+}
+
+float Component(const Math3D::Vector3& vector, int axis) {
+    return axis == 0 ? vector.x : (axis == 1 ? vector.y : vector.z);
+}
+
+struct ProjectedVertex {
+    float u, v, depth;
+};
+
+void RasterizeTriangle(const ProjectedVertex& a, const ProjectedVertex& b, const ProjectedVertex& c,
+                       std::vector<float>& depthBuffer, size_t& pixelsShaded) {
+    float area = (b.u - a.u) * (c.v - a.v) - (b.v - a.v) * (c.u - a.u);
+    if (area == 0.0f) {
+        return;
+    }
+    float invArea = 1.0f / area;
+
+    int minX = std::max(0, static_cast<int>(std::floor(std::min({ a.u, b.u, c.u }))));
+    int minY = std::max(0, static_cast<int>(std::floor(std::min({ a.v, b.v, c.v }))));
+    int maxX = std::min(OVERDRAW_GRID_SIZE - 1, static_cast<int>(std::ceil(std::max({ a.u, b.u, c.u }))));
+    int maxY = std::min(OVERDRAW_GRID_SIZE - 1, static_cast<int>(std::ceil(std::max({ a.v, b.v, c.v }))));
+
+    for (int y = minY; y <= maxY; ++y) {
+        float py = static_cast<float>(y) + 0.5f;
+        for (int x = minX; x <= maxX; ++x) {
+            float px = static_cast<float>(x) + 0.5f;
+            float w0 = ((b.u - px) * (c.v - py) - (b.v - py) * (c.u - px)) * invArea;
+            float w1 = ((c.u - px) * (a.v - py) - (c.v - py) * (a.u - px)) * invArea;
+            float w2 = 1.0f - w0 - w1;
+            if (w0 < 0.0f || w1 < 0.0f || w2 < 0.0f) {
+                continue;
+            }
+            float depth = w0 * a.depth + w1 * b.depth + w2 * c.depth;
+            float& stored = depthBuffer[static_cast<size_t>(y) * OVERDRAW_GRID_SIZE + x];
+            if (depth < stored) {
+                stored = depth;
+                pixelsShaded++;
+            }
+        }
+    }
+}
+
+}
+
+void Mesh::OptimizeVertexCache() {
+    const size_t vertexCount = GetVertexCount();
+    const size_t triangleCount = GetTriangleCount();
+    if (triangleCount == 0) {
+        return;
+    }
+
+    std::vector<uint32_t> valid;
+    std::vector<uint32_t> invalid;
+    valid.reserve(triangleCount * 3);
+    for (size_t t = 0; t < triangleCount; ++t) {
+        const uint32_t* triangle = indices.data() + t * 3;
+        bool inRange = triangle[0] < vertexCount && triangle[1] < vertexCount && triangle[2] < vertexCount;
+        std::vector<uint32_t>& target = inRange ? valid : invalid;
+        target.insert(target.end(), triangle, triangle + 3);
+    }
+
+    std::vector<uint32_t> order;
+    OptimizeTriangleOrder(valid.data(), valid.size() / 3, vertexCount, order);
+
+    for (size_t t = 0; t < order.size(); ++t) {
+        std::copy(valid.begin() + order[t] * 3, valid.begin() + order[t] * 3 + 3, indices.begin() + t * 3);
+    }
+    std::copy(invalid.begin(), invalid.end(), indices.begin() + valid.size());
+}
+
+VertexCacheStatistics Mesh::AnalyzeVertexCache(size_t cacheSize) const {
+    VertexCacheStatistics statistics;
+    const size_t vertexCount = GetVertexCount();
+    const size_t indexCount = indices.empty() ? vertexCount - vertexCount % 3 : indices.size() - indices.size() % 3;
+    if (indexCount == 0 || cacheSize == 0) {
+        return statistics;
+    }
+
+    std::vector<uint32_t> fifo(cacheSize, UINT32_MAX);
+    std::vector<bool> referenced(vertexCount, false);
+    size_t head = 0;
+    size_t uniqueVertices = 0;
+
+    for (size_t i = 0; i < indexCount; ++i) {
+        uint32_t vertex = indices.empty() ? static_cast<uint32_t>(i) : indices[i];
+        if (vertex < vertexCount && !referenced[vertex]) {
+            referenced[vertex] = true;
+            uniqueVertices++;
+        }
+        if (std::find(fifo.begin(), fifo.end(), vertex) == fifo.end()) {
+            fifo[head] = vertex;
+            head = (head + 1) % cacheSize;
+            statistics.verticesTransformed++;
+        }
+    }
+
+    statistics.acmr = static_cast<float>(statistics.verticesTransformed) / static_cast<float>(indexCount / 3);
+    statistics.atvr = uniqueVertices > 0
+        ? static_cast<float>(statistics.verticesTransformed) / static_cast<float>(uniqueVertices)
+        : 0.0f;
+    return statistics;
+}
+
+void Mesh::OptimizeOverdraw(float threshold) {
+    const size_t vertexCount = GetVertexCount();
+    const size_t triangleCount = GetTriangleCount();
+    if (triangleCount == 0) {
+        return;
+    }
+    for (size_t i = 0; i < triangleCount * 3; ++i) {
+        if (indices[i] >= vertexCount) {
+            return;
+        }
+    }
+
+    std::vector<size_t> clusters;
+    GenerateClusters(indices.data(), triangleCount, threshold, clusters);
+    const size_t clusterCount = clusters.size() - 1;
+
+    Math3D::Vector3 meshCentroid = Math3D::Vector3::Zero;
+    float meshArea = 0.0f;
+    std::vector<Math3D::Vector3> clusterCentroids(clusterCount, Math3D::Vector3::Zero);
+    std::vector<Math3D::Vector3> clusterNormals(clusterCount, Math3D::Vector3::Zero);
+    std::vector<float> clusterAreas(clusterCount, 0.0f);
+
+    for (size_t cluster = 0; cluster < clusterCount; ++cluster) {
+        for (size_t t = clusters[cluster]; t < clusters[cluster + 1]; ++t) {
+            Math3D::Vector3 p0 = GetPosition(indices[t * 3]);
+            Math3D::Vector3 p1 = GetPosition(indices[t * 3 + 1]);
+            Math3D::Vector3 p2 = GetPosition(indices[t * 3 + 2]);
+            Math3D::Vector3 normal = (p1 - p0).Cross(p2 - p0);
+            float area = normal.Length();
+            Math3D::Vector3 weighted = (p0 + p1 + p2) * (area / 3.0f);
+
+            clusterCentroids[cluster] += weighted;
+            clusterNormals[cluster] += normal;
+            clusterAreas[cluster] += area;
+            meshCentroid += weighted;
+            meshArea += area;
+        }
+    }
+    if (meshArea > 0.0f) {
+        meshCentroid /= meshArea;
+    }
+
+    std::vector<float> sortKeys(clusterCount, 0.0f);
+    for (size_t cluster = 0; cluster < clusterCount; ++cluster) {
+        if (clusterAreas[cluster] > 0.0f) {
+            Math3D::Vector3 centroid = clusterCentroids[cluster] / clusterAreas[cluster];
+            sortKeys[cluster] = (centroid - meshCentroid).Dot(clusterNormals[cluster].Normalized());
+        }
+    }
+
+    std::vector<size_t> order(clusterCount);
+    for (size_t cluster = 0; cluster < clusterCount; ++cluster) {
+        order[cluster] = cluster;
+    }
+    std::stable_sort(order.begin(), order.end(), [&](size_t a, size_t b) { return sortKeys[a] > sortKeys[b]; });
+
+    std::vector<uint32_t> sorted;
+    sorted.reserve(triangleCount * 3);
+    for (size_t cluster : order) {
+        sorted.insert(sorted.end(), indices.begin() + clusters[cluster] * 3,
+                      indices.begin() + clusters[cluster + 1] * 3);
+    }
+    std::copy(sorted.begin(), sorted.end(), indices.begin());
+}
+
+OverdrawStatistics Mesh::AnalyzeOverdraw() const {
+    OverdrawStatistics statistics;
+    const size_t vertexCount = GetVertexCount();
+    const size_t triangleCount = GetTriangleCount();
+    if (triangleCount == 0 || vertexCount == 0) {
+        return statistics;
+    }
+
+    BoundingBox box;
+    for (size_t i = 0; i < vertexCount; ++i) {
+        box.Expand(GetPosition(i));
+    }
+    Math3D::Vector3 size = box.GetSize();
+    float extent = std::max(size.x, std::max(size.y, size.z));
+    float scale = extent > 0.0f ? static_cast<float>(OVERDRAW_GRID_SIZE - 1) / extent : 0.0f;
+
+    std::vector<float> depthBuffer(static_cast<size_t>(OVERDRAW_GRID_SIZE) * OVERDRAW_GRID_SIZE);
+    std::vector<ProjectedVertex> projected(vertexCount);
+
+    for (int axis = 0; axis < 3; ++axis) {
+        int uAxis = (axis + 1) % 3;
+        int vAxis = (axis + 2) % 3;
+        for (float direction : { 1.0f, -1.0f }) {
+            for (size_t i = 0; i < vertexCount; ++i) {
+                Math3D::Vector3 local = (GetPosition(i) - box.min) * scale;
+                projected[i] = { Component(local, uAxis), Component(local, vAxis),
+                                 -direction * Component(local, axis) };
+            }
+            std::fill(depthBuffer.begin(), depthBuffer.end(), std::numeric_limits<float>::max());
+
+            for (size_t t = 0; t < triangleCount; ++t) {
+                const uint32_t* triangle = indices.data() + t * 3;
+                if (triangle[0] >= vertexCount || triangle[1] >= vertexCount || triangle[2] >= vertexCount) {
+                    continue;
+                }
+                Math3D::Vector3 p0 = GetPosition(triangle[0]);
+                Math3D::Vector3 normal = (GetPosition(triangle[1]) - p0).Cross(GetPosition(triangle[2]) - p0);
+                if (Component(normal, axis) * direction <= 0.0f) {
+                    continue;
+                }
+                RasterizeTriangle(projected[triangle[0]], projected[triangle[1]], projected[triangle[2]],
+                                  depthBuffer, statistics.pixelsShaded);
+            }
+
+            for (float depth : depthBuffer) {
+                statistics.pixelsCovered += depth < std::numeric_limits<float>::max() ? 1 : 0;
+            }
+        }
+    }
+
+    statistics.overdraw = statistics.pixelsCovered > 0
+        ? static_cast<float>(statistics.pixelsShaded) / static_cast<float>(statistics.pixelsCovered)
+        : 0.0f;
+    return statistics;
+}
+
+size_t Mesh::OptimizeVertexFetch() {
+    const size_t vertexCount = GetVertexCount();
+    std::vector<uint32_t> remap(vertexCount, REMOVED_VERTEX);
+    uint32_t next = 0;
+    for (uint32_t index : indices) {
+        if (index < vertexCount && remap[index] == REMOVED_VERTEX) {
+            remap[index] = next++;
+        }
+    }
+    if (indices.empty()) {
+        for (uint32_t i = 0; i < vertexCount; ++i) {
+            remap[i] = i;
+        }
+        next = static_cast<uint32_t>(vertexCount);
+    }
+
+    RemapVertices(remap, next);
+    return next;
+}
+
+size_t Mesh::WeldVertices(float epsilon, VertexAttribute attributes, float attributeEpsilon) {
+    const size_t vertexCount = GetVertexCount();
+    if (vertexCount == 0) {
+        return 0;
+    }
+
+    const float tolerance = std::max(epsilon, 0.0f);
+    const double invCellSize = tolerance > 0.0f ? 0.5 / static_cast<double>(tolerance) : 1.0;
+
+    SpatialHash hash(vertexCount);
+    std::vector<uint32_t> chain(vertexCount, REMOVED_VERTEX);
+    std::vector<uint32_t> remap(vertexCount);
+    uint32_t kept = 0;
+
+    for (size_t i = 0; i < vertexCount; ++i) {
+        Vertex vertex = GetVertex(i);
+        const Math3D::Vector3& p = vertex.position;
+
+        int64_t low[3], high[3];
+        bool hashable = true;
+        for (int axis = 0; axis < 3; ++axis) {
+            double value = static_cast<double>(Component(p, axis));
+            double lowCell = std::floor((value - tolerance) * invCellSize);
+            double highCell = std::floor((value + tolerance) * invCellSize);
+            hashable &= std::fabs(lowCell) < MAX_CELL_COORDINATE && std::fabs(highCell) < MAX_CELL_COORDINATE;
+            low[axis] = hashable ? static_cast<int64_t>(lowCell) : 0;
+            high[axis] = hashable ? static_cast<int64_t>(highCell) : 0;
+        }
+
+        uint32_t match = REMOVED_VERTEX;
+        for (int64_t x = low[0]; hashable && x <= high[0] && match == REMOVED_VERTEX; ++x) {
+            for (int64_t y = low[1]; y <= high[1] && match == REMOVED_VERTEX; ++y) {
+                for (int64_t z = low[2]; z <= high[2] && match == REMOVED_VERTEX; ++z) {
+                    for (uint32_t candidate = hash.Find({ x, y, z }); candidate != REMOVED_VERTEX;
+                         candidate = chain[candidate]) {
+                        if (CanWeld(GetVertex(candidate), vertex, tolerance, attributes, attributeEpsilon)) {
+                            match = candidate;
+                            break;
+                        }
+                    }
+                }
+            }
+        }
+
+        if (match != REMOVED_VERTEX) {
+            remap[i] = remap[match];
+            continue;
+        }
+
+        remap[i] = kept++;
+        if (hashable) {
+            CellKey cell = { CellCoordinate(p.x, invCellSize), CellCoordinate(p.y, invCellSize),
+                             CellCoordinate(p.z, invCellSize) };
+            uint32_t& head = hash.Head(cell);
+            chain[i] = head;
+            head = static_cast<uint32_t>(i);
+        }
+    }
+
+    size_t removed = vertexCount - kept;
+    if (removed > 0) {
+        RemapVertices(remap, kept);
+    }
+    return removed;
+}
+
+void Mesh::RemapVertices(const std::vector<uint32_t>& remap, size_t vertexCount) {
+    const size_t oldCount = GetVertexCount();
+    if (m_layout == VertexLayout::Streams) {
+        VertexStreams remapped;
+        remapped.Resize(vertexCount);
+        for (size_t i = oldCount; i-- > 0;) {
+            if (remap[i] != REMOVED_VERTEX) {
+                remapped.Set(remap[i], streams.Get(i));
+            }
+        }
+        streams = std::move(remapped);
+    } else {
+        std::vector<Vertex> remapped(vertexCount);
+        for (size_t i = oldCount; i-- > 0;) {
+            if (remap[i] != REMOVED_VERTEX) {
+                remapped[remap[i]] = vertices[i];
+            }
+        }
+        vertices.swap(remapped);
+    }
+
+    for (uint32_t& index : indices) {
+        if (index < oldCount) {
+            index = remap[index];
+        }
+    }
+    UpdateBounds();
+}
+
+}
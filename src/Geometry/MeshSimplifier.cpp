@@ -0,0 +1,494 @@
+#include "Geometry/Mesh.h"
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+#include <unordered_map>
+
+using Math3D::Vector3;
+
+namespace Geometry {
+
+namespace {
+
+const double BOUNDARY_WEIGHT = 10.0;
+const uint32_t NO_VERTEX = UINT32_MAX;
+
+enum class VertexKind {
+    Manifold,
+    Border,
+    Seam,
+    Locked
+};
+
+class Quadric {
+public:
+    void AddPlane(const Vector3& normal, double distance, double weight) {
+        double nx = normal.x, ny = normal.y, nz = normal.z;
+        m_a00 += weight * nx * nx;
+        m_a11 += weight * ny * ny;
+        m_a22 += weight * nz * nz;
+        m_a10 += weight * nx * ny;
+        m_a20 += weight * nx * nz;
+        m_a21 += weight * ny * nz;
+        m_b0 += weight * nx * distance;
+        m_b1 += weight * ny * distance;
+        m_b2 += weight * nz * distance;
+        m_c += weight * distance * distance;
+        m_weight += weight;
+    }
+
+    Quadric& operator+=(const Quadric& other) {
+        m_a00 += other.m_a00;
+        m_a11 += other.m_a11;
+        m_a22 += other.m_a22;
+        m_a10 += other.m_a10;
+        m_a20 += other.m_a20;
+        m_a21 += other.m_a21;
+        m_b0 += other.m_b0;
+        m_b1 += other.m_b1;
+        m_b2 += other.m_b2;
+        m_c += other.m_c;
+        m_weight += other.m_weight;
+        return *this;
+    }
+
+    double Evaluate(const Vector3& point) const {
+        if (m_weight <= 0.0) {
+            return 0.0;
+        }
+        double x = point.x, y = point.y, z = point.z;
+        double error = m_a00 * x * x + m_a11 * y * y + m_a22 * z * z +
+                       2.0 * (m_a10 * x * y + m_a20 * x * z + m_a21 * y * z) +
+                       2.0 * (m_b0 * x + m_b1 * y + m_b2 * z) + m_c;
+        return std::max(error, 0.0) / m_weight;
+    }
+
+private:
+    double m_a00 = 0.0, m_a11 = 0.0, m_a22 = 0.0;
+    double m_a10 = 0.0, m_a20 = 0.0, m_a21 = 0.0;
+    double m_b0 = 0.0, m_b1 = 0.0, m_b2 = 0.0;
+    double m_c = 0.0;
+    double m_weight = 0.0;
+};
+
+struct PositionKey {
+    uint32_t bits[3];
+
+    bool operator==(const PositionKey& other) const {
+        return bits[0] == other.bits[0] && bits[1] == other.bits[1] && bits[2] == other.bits[2];
+    }
+};
+
+struct PositionKeyHash {
+    size_t operator()(const PositionKey& key) const {
+        uint64_t hash = key.bits[0] * 0x9E3779B1ull;
+        hash = (hash ^ key.bits[1]) * 0x85EBCA77ull;
+        hash = (hash ^ key.bits[2]) * 0xC2B2AE3Dull;
+        return static_cast<size_t>(hash ^ (hash >> 32));
+    }
+};
+
+PositionKey MakePositionKey(const Vector3& position) {
+    float values[3] = { position.x + 0.0f, position.y + 0.0f, position.z + 0.0f };
+    PositionKey key;
+    std::memcpy(key.bits, values, sizeof(values));
+    return key;
+}
+
+struct EdgeRecord {
+    uint32_t triangles = 0;
+    uint32_t lower[2] = { NO_VERTEX, NO_VERTEX };
+    uint32_t upper[2] = { NO_VERTEX, NO_VERTEX };
+    bool seam = false;
+};
+
+uint64_t EdgeKey(uint32_t a, uint32_t b) {
+    return a < b ? (static_cast<uint64_t>(a) << 32) | b : (static_cast<uint64_t>(b) << 32) | a;
+}
+
+struct Collapse {
+    uint32_t source;
+    uint32_t target;
+    double error;
+};
+
+class Simplifier {
+public:
+    Simplifier(const Mesh& mesh, const std::vector<uint32_t>& indices)
+        : m_indices(indices) {
+        const size_t vertexCount = mesh.GetVertexCount();
+        m_group.resize(vertexCount);
+
+        std::unordered_map<PositionKey, uint32_t, PositionKeyHash> groups;
+        groups.reserve(vertexCount);
+        for (size_t i = 0; i < vertexCount; ++i) {
+            Vector3 position = mesh.GetPosition(i);
+            auto inserted = groups.emplace(MakePositionKey(position), static_cast<uint32_t>(m_positions.size()));
+            if (inserted.second) {
+                m_positions.push_back(position);
+            }
+            m_group[i] = inserted.first->second;
+        }
+
+        m_quadrics.resize(m_positions.size());
+        m_kinds.resize(m_positions.size());
+        ClassifyVertices();
+        AccumulateQuadrics();
+    }
+
+    const std::vector<uint32_t>& GetIndices() const { return m_indices; }
+    double GetError() const { return m_error; }
+
+    bool RunPass(size_t targetIndexCount, double errorLimit) {
+        const size_t triangleCount = m_indices.size() / 3;
+        const size_t targetTriangles = targetIndexCount / 3;
+        BuildAdjacency();
+
+        std::vector<Collapse> collapses;
+        collapses.reserve(m_indices.size());
+        for (size_t t = 0; t < triangleCount; ++t) {
+            for (int k = 0; k < 3; ++k) {
+                uint32_t a = m_indices[t * 3 + k];
+                uint32_t b = m_indices[t * 3 + (k + 1) % 3];
+                if (m_group[a] > m_group[b] && m_edges.find(EdgeKey(m_group[a], m_group[b]))->second.triangles > 1) {
+                    continue;
+                }
+                Collapse forward = { a, b, CollapseError(a, b) };
+                Collapse backward = { b, a, CollapseError(b, a) };
+                const Collapse& best = forward.error <= backward.error ? forward : backward;
+                if (best.error < HUGE_VAL) {
+                    collapses.push_back(best);
+                }
+            }
+        }
+        std::sort(collapses.begin(), collapses.end(),
+                  [](const Collapse& a, const Collapse& b) { return a.error < b.error; });
+
+        size_t goal = std::max<size_t>(1, (triangleCount - targetTriangles) / 2);
+        double passLimit = collapses.empty() ? 0.0 : collapses[std::min(goal * 3, collapses.size()) - 1].error;
+        passLimit = std::max(passLimit, 1e-12);
+        std::vector<bool> touched(m_positions.size(), false);
+        std::vector<uint32_t> remap(m_group.size());
+        for (size_t i = 0; i < remap.size(); ++i) {
+            remap[i] = static_cast<uint32_t>(i);
+        }
+
+        size_t performed = 0;
+        std::vector<uint32_t> sourceWedges, targetWedges;
+        for (const Collapse& collapse : collapses) {
+            if (performed >= goal || collapse.error > errorLimit) {
+                break;
+            }
+            if (collapse.error > passLimit && performed > 0) {
+                break;
+            }
+            uint32_t sourceGroup = m_group[collapse.source];
+            uint32_t targetGroup = m_group[collapse.target];
+            if (touched[sourceGroup] || touched[targetGroup]) {
+                continue;
+            }
+            if (!MatchWedges(collapse, sourceWedges, targetWedges) || HasTriangleFlip(sourceWedges, targetGroup)) {
+                continue;
+            }
+
+            for (size_t w = 0; w < sourceWedges.size(); ++w) {
+                remap[sourceWedges[w]] = targetWedges[w];
+                uint32_t wedge = sourceWedges[w];
+                for (uint32_t a = m_adjacencyOffsets[wedge]; a < m_adjacencyOffsets[wedge + 1]; ++a) {
+                    const uint32_t* triangle = m_indices.data() + m_adjacency[a] * 3;
+                    touched[m_group[triangle[0]]] = true;
+                    touched[m_group[triangle[1]]] = true;
+                    touched[m_group[triangle[2]]] = true;
+                }
+            }
+            m_quadrics[targetGroup] += m_quadrics[sourceGroup];
+            m_error = std::max(m_error, collapse.error);
+            performed++;
+        }
+
+        if (performed == 0) {
+            return false;
+        }
+
+        size_t write = 0;
+        for (size_t t = 0; t < triangleCount; ++t) {
+            uint32_t a = remap[m_indices[t * 3]];
+            uint32_t b = remap[m_indices[t * 3 + 1]];
+            uint32_t c = remap[m_indices[t * 3 + 2]];
+            if (m_group[a] == m_group[b] || m_group[b] == m_group[c] || m_group[a] == m_group[c]) {
+                continue;
+            }
+            m_indices[write++] = a;
+            m_indices[write++] = b;
+            m_indices[write++] = c;
+        }
+        m_indices.resize(write);
+
+        ClassifyVertices();
+        return true;
+    }
+
+private:
+    void ClassifyVertices() {
+        m_edges.clear();
+        m_edges.reserve(m_indices.size());
+        for (size_t i = 0; i + 2 < m_indices.size(); i += 3) {
+            for (int k = 0; k < 3; ++k) {
+                uint32_t a = m_indices[i + k];
+                uint32_t b = m_indices[i + (k + 1) % 3];
+                if (m_group[a] > m_group[b]) {
+                    std::swap(a, b);
+                }
+                EdgeRecord& edge = m_edges[EdgeKey(m_group[a], m_group[b])];
+                if (edge.triangles < 2) {
+                    edge.lower[edge.triangles] = a;
+                    edge.upper[edge.triangles] = b;
+                }
+                if (edge.triangles == 1 && (edge.lower[0] != a || edge.upper[0] != b)) {
+                    edge.seam = true;
+                }
+                edge.triangles++;
+            }
+        }
+
+        std::vector<uint32_t> borderEdges(m_positions.size(), 0);
+        std::vector<uint32_t> seamEdges(m_positions.size(), 0);
+        std::vector<bool> locked(m_positions.size(), false);
+        for (const auto& entry : m_edges) {
+            uint32_t a = static_cast<uint32_t>(entry.first >> 32);
+            uint32_t b = static_cast<uint32_t>(entry.first & 0xFFFFFFFFu);
+            const EdgeRecord& edge = entry.second;
+            if (edge.triangles == 1) {
+                borderEdges[a]++;
+                borderEdges[b]++;
+            } else if (edge.triangles == 2 && edge.seam) {
+                seamEdges[a]++;
+                seamEdges[b]++;
+            } else if (edge.triangles > 2) {
+                locked[a] = true;
+                locked[b] = true;
+            }
+        }
+
+        std::vector<uint32_t> wedges(m_positions.size(), 0);
+        std::vector<bool> referenced(m_group.size(), false);
+        for (uint32_t index : m_indices) {
+            if (!referenced[index]) {
+                referenced[index] = true;
+                wedges[m_group[index]]++;
+            }
+        }
+
+        for (size_t g = 0; g < m_positions.size(); ++g) {
+            VertexKind kind = VertexKind::Locked;
+            if (!locked[g] && wedges[g] == 1 && seamEdges[g] == 0) {
+                if (borderEdges[g] == 0) {
+                    kind = VertexKind::Manifold;
+                } else if (borderEdges[g] == 2) {
+                    kind = VertexKind::Border;
+                }
+            } else if (!locked[g] && wedges[g] == 2 && borderEdges[g] == 0 && seamEdges[g] == 2) {
+                kind = VertexKind::Seam;
+            }
+            m_kinds[g] = kind;
+        }
+    }
+
+    void AccumulateQuadrics() {
+        for (size_t i = 0; i + 2 < m_indices.size(); i += 3) {
+            uint32_t groups[3] = { m_group[m_indices[i]], m_group[m_indices[i + 1]], m_group[m_indices[i + 2]] };
+            const Vector3& p0 = m_positions[groups[0]];
+            const Vector3& p1 = m_positions[groups[1]];
+            const Vector3& p2 = m_positions[groups[2]];
+            Vector3 normal = (p1 - p0).Cross(p2 - p0);
+            float doubleArea = normal.Length();
+            if (doubleArea <= 0.0f) {
+                continue;
+            }
+            normal /= doubleArea;
+            double distance = -normal.Dot(p0);
+            for (uint32_t group : groups) {
+                m_quadrics[group].AddPlane(normal, distance, doubleArea * 0.5);
+            }
+
+            for (int k = 0; k < 3; ++k) {
+                uint32_t a = groups[k];
+                uint32_t b = groups[(k + 1) % 3];
+                auto found = m_edges.find(EdgeKey(a, b));
+                if (found == m_edges.end() || (found->second.triangles != 1 && !found->second.seam)) {
+                    continue;
+                }
+                Vector3 edge = m_positions[b] - m_positions[a];
+                Vector3 boundaryNormal = edge.Cross(normal).Normalized();
+                double boundaryDistance = -boundaryNormal.Dot(m_positions[a]);
+                double weight = BOUNDARY_WEIGHT * edge.LengthSquared();
+                m_quadrics[a].AddPlane(boundaryNormal, boundaryDistance, weight);
+                m_quadrics[b].AddPlane(boundaryNormal, boundaryDistance, weight);
+            }
+        }
+    }
+
+    void BuildAdjacency() {
+        m_adjacencyOffsets.assign(m_group.size() + 1, 0);
+        for (uint32_t index : m_indices) {
+            m_adjacencyOffsets[index + 1]++;
+        }
+        for (size_t i = 0; i < m_group.size(); ++i) {
+            m_adjacencyOffsets[i + 1] += m_adjacencyOffsets[i];
+        }
+        std::vector<uint32_t> cursor(m_adjacencyOffsets.begin(), m_adjacencyOffsets.end() - 1);
+        m_adjacency.resize(m_indices.size());
+        for (size_t i = 0; i < m_indices.size(); ++i) {
+            m_adjacency[cursor[m_indices[i]]++] = static_cast<uint32_t>(i / 3);
+        }
+    }
+
+    double CollapseError(uint32_t source, uint32_t target) const {
+        uint32_t sourceGroup = m_group[source];
+        uint32_t targetGroup = m_group[target];
+        VertexKind kind = m_kinds[sourceGroup];
+        if (sourceGroup == targetGroup || kind == VertexKind::Locked) {
+            return HUGE_VAL;
+        }
+        if (kind != VertexKind::Manifold) {
+            auto found = m_edges.find(EdgeKey(sourceGroup, targetGroup));
+            if (found == m_edges.end()) {
+                return HUGE_VAL;
+            }
+            bool border = found->second.triangles == 1;
+            bool seam = found->second.triangles == 2 && found->second.seam;
+            if ((kind == VertexKind::Border && !border) || (kind == VertexKind::Seam && !seam)) {
+                return HUGE_VAL;
+            }
+        }
+
+        Quadric combined = m_quadrics[sourceGroup];
+        combined += m_quadrics[targetGroup];
+        return combined.Evaluate(m_positions[targetGroup]);
+    }
+
+    bool MatchWedges(const Collapse& collapse, std::vector<uint32_t>& sourceWedges,
+                     std::vector<uint32_t>& targetWedges) const {
+        sourceWedges.assign(1, collapse.source);
+        targetWedges.assign(1, collapse.target);
+        uint32_t sourceGroup = m_group[collapse.source];
+        if (m_kinds[sourceGroup] != VertexKind::Seam) {
+            return true;
+        }
+
+        uint32_t targetGroup = m_group[collapse.target];
+        for (uint32_t a = m_adjacencyOffsets[collapse.source]; a < m_adjacencyOffsets[collapse.source + 1]; ++a) {
+            const uint32_t* triangle = m_indices.data() + m_adjacency[a] * 3;
+            for (int k = 0; k < 3; ++k) {
+                if (m_group[triangle[k]] == targetGroup && triangle[k] != collapse.target) {
+                    return false;
+                }
+            }
+        }
+
+        const EdgeRecord& edge = m_edges.find(EdgeKey(sourceGroup, targetGroup))->second;
+        bool sourceLower = sourceGroup < targetGroup;
+        const uint32_t* sources = sourceLower ? edge.lower : edge.upper;
+        const uint32_t* targets = sourceLower ? edge.upper : edge.lower;
+        int side = sources[0] == collapse.source ? 0 : 1;
+        if (sources[side] != collapse.source || targets[side] != collapse.target ||
+            sources[1 - side] == collapse.source || targets[1 - side] == collapse.target) {
+            return false;
+        }
+        uint32_t otherSource = sources[1 - side];
+        uint32_t otherTarget = targets[1 - side];
+
+        sourceWedges.push_back(otherSource);
+        targetWedges.push_back(otherTarget);
+        return true;
+    }
+
+    bool HasTriangleFlip(const std::vector<uint32_t>& sourceWedges, uint32_t targetGroup) const {
+        const Vector3& target = m_positions[targetGroup];
+        for (uint32_t wedge : sourceWedges) {
+            for (uint32_t a = m_adjacencyOffsets[wedge]; a < m_adjacencyOffsets[wedge + 1]; ++a) {
+                const uint32_t* triangle = m_indices.data() + m_adjacency[a] * 3;
+                uint32_t groups[3] = { m_group[triangle[0]], m_group[triangle[1]], m_group[triangle[2]] };
+                if (groups[0] == targetGroup || groups[1] == targetGroup || groups[2] == targetGroup) {
+                    continue;
+                }
+
+                Vector3 before[3], after[3];
+                for (int k = 0; k < 3; ++k) {
+                    before[k] = m_positions[groups[k]];
+                    after[k] = triangle[k] == wedge ? target : before[k];
+                }
+                Vector3 normalBefore = (before[1] - before[0]).Cross(before[2] - before[0]);
+                Vector3 normalAfter = (after[1] - after[0]).Cross(after[2] - after[0]);
+                if (normalBefore.Dot(normalAfter) <= 0.0f) {
+                    return true;
+                }
+            }
+        }
+        return false;
+    }
+
+    std::vector<uint32_t> m_indices;
+    std::vector<uint32_t> m_group;
+    std::vector<Vector3> m_positions;
+    std::vector<Quadric> m_quadrics;
+    std::vector<VertexKind> m_kinds;
+    std::unordered_map<uint64_t, EdgeRecord> m_edges;
+    std::vector<uint32_t> m_adjacencyOffsets;
+    std::vector<uint32_t> m_adjacency;
+    double m_error = 0.0;
+};
+
+}
+
+float Mesh::Simplify(size_t targetIndexCount, float maxError) {
+    const size_t vertexCount = GetVertexCount();
+    const size_t indexCount = GetTriangleCount() * 3;
+    if (indexCount <= targetIndexCount) {
+        return 0.0f;
+    }
+    for (size_t i = 0; i < indexCount; ++i) {
+        if (indices[i] >= vertexCount) {
+            return 0.0f;
+        }
+    }
+
+    Simplifier simplifier(*this, std::vector<uint32_t>(indices.begin(), indices.begin() + indexCount));
+    double errorLimit = static_cast<double>(maxError) * static_cast<double>(maxError);
+    while (simplifier.GetIndices().size() > targetIndexCount &&
+           simplifier.RunPass(targetIndexCount, errorLimit)) {
+    }
+
+    indices = simplifier.GetIndices();
+    return static_cast<float>(std::sqrt(simplifier.GetError()));
+}
+
+std::vector<MeshLOD> Mesh::GenerateLODs(const std::vector<float>& ratios) const {
+    std::vector<float> levels;
+    for (float ratio : ratios) {
+        levels.push_back(Math3D::MathUtils::Clamp(ratio, 0.0f, 1.0f));
+    }
+    std::sort(levels.begin(), levels.end(), [](float a, float b) { return a > b; });
+
+    std::vector<MeshLOD> lods;
+    const size_t sourceTriangles = GetTriangleCount();
+    Mesh current = *this;
+    float error = 0.0f;
+    for (float level : levels) {
+        size_t targetIndexCount = static_cast<size_t>(level * static_cast<float>(sourceTriangles)) * 3;
+        error += current.Simplify(targetIndexCount);
+        current.OptimizeVertexCache();
+        current.OptimizeVertexFetch();
+
+        MeshLOD lod;
+        lod.mesh = current;
+        lod.ratio = sourceTriangles > 0
+            ? static_cast<float>(current.GetTriangleCount()) / static_cast<float>(sourceTriangles)
+            : 0.0f;
+        lod.error = error;
+        lods.push_back(lod);
+    }
+    return lods;
+}
+
+}
@@ -0,0 +1,281 @@
+#include "Geometry/Meshlet.h"
+#include "Math3D/MathUtils.h"
+#include <algorithm>
+#include <cmath>
+
+using Math3D::Vector3;
+
+namespace Geometry {
+
+namespace {
+
+const uint32_t NO_INDEX = UINT32_MAX;
+const float MIN_CONE_SPREAD = 0.1f;
+
+struct MeshletAdjacency {
+    std::vector<uint32_t> offsets;
+    std::vector<uint32_t> triangles;
+    std::vector<uint32_t> liveCounts;
+};
+
+MeshletAdjacency BuildAdjacency(const std::vector<uint32_t>& indices, size_t vertexCount) {
+    MeshletAdjacency adjacency;
+    adjacency.offsets.assign(vertexCount + 1, 0);
+    adjacency.liveCounts.assign(vertexCount, 0);
+    for (uint32_t index : indices) {
+        adjacency.liveCounts[index]++;
+    }
+    for (size_t i = 0; i < vertexCount; ++i) {
+        adjacency.offsets[i + 1] = adjacency.offsets[i] + adjacency.liveCounts[i];
+    }
+
+    std::vector<uint32_t> cursor(adjacency.offsets.begin(), adjacency.offsets.end() - 1);
+    adjacency.triangles.resize(indices.size());
+    for (size_t i = 0; i < indices.size(); ++i) {
+        adjacency.triangles[cursor[indices[i]]++] = static_cast<uint32_t>(i / 3);
+    }
+    return adjacency;
+}
+
+void ComputeMeshletBounds(Meshlet& meshlet, const MeshletMesh& result, const std::vector<Vector3>& positions) {
+    meshlet.bounds.Reset();
+    for (uint32_t i = 0; i < meshlet.vertexCount; ++i) {
+        meshlet.bounds.Expand(positions[result.vertices[meshlet.vertexOffset + i]]);
+    }
+    meshlet.center = meshlet.bounds.GetCenter();
+    float radiusSquared = 0.0f;
+    for (uint32_t i = 0; i < meshlet.vertexCount; ++i) {
+        Vector3 offset = positions[result.vertices[meshlet.vertexOffset + i]] - meshlet.center;
+        radiusSquared = std::max(radiusSquared, offset.LengthSquared());
+    }
+    meshlet.radius = std::sqrt(radiusSquared);
+
+    std::vector<Vector3> normals;
+    std::vector<Vector3> corners;
+    normals.reserve(meshlet.triangleCount);
+    corners.reserve(meshlet.triangleCount);
+    Vector3 axis = Vector3::Zero;
+    for (uint32_t t = 0; t < meshlet.triangleCount; ++t) {
+        const uint8_t* local = result.triangles.data() + (meshlet.triangleOffset + t) * 3;
+        const Vector3& p0 = positions[result.vertices[meshlet.vertexOffset + local[0]]];
+        const Vector3& p1 = positions[result.vertices[meshlet.vertexOffset + local[1]]];
+        const Vector3& p2 = positions[result.vertices[meshlet.vertexOffset + local[2]]];
+        Vector3 normal = (p1 - p0).Cross(p2 - p0);
+        float length = normal.Length();
+        if (length <= 0.0f) {
+            continue;
+        }
+        normal /= length;
+        normals.push_back(normal);
+        corners.push_back(p0);
+        axis += normal;
+    }
+
+    meshlet.coneCutoff = 1.0f;
+    float axisLength = axis.Length();
+    if (normals.empty() || axisLength <= Math3D::MathUtils::EPSILON) {
+        return;
+    }
+    axis /= axisLength;
+
+    float minDot = 1.0f;
+    for (const Vector3& normal : normals) {
+        minDot = std::min(minDot, normal.Dot(axis));
+    }
+    if (minDot <= MIN_CONE_SPREAD) {
+        return;
+    }
+
+    float maxT = 0.0f;
+    for (size_t i = 0; i < normals.size(); ++i) {
+        float distance = (meshlet.center - corners[i]).Dot(normals[i]);
+        maxT = std::max(maxT, distance / normals[i].Dot(axis));
+    }
+    meshlet.coneAxis = axis;
+    meshlet.coneApex = meshlet.center - axis * maxT;
+    meshlet.coneCutoff = std::sqrt(1.0f - minDot * minDot);
+}
+
+}
+
+bool Meshlet::IsBackFacing(const Vector3& cameraPosition) const {
+    if (!HasNormalCone()) {
+        return false;
+    }
+    Vector3 view = coneApex - cameraPosition;
+    return view.Dot(coneAxis) >= coneCutoff * view.Length();
+}
+
+MeshletMesh MeshletMesh::Build(const Mesh& mesh, size_t maxVertices, size_t maxTriangles) {
+    MeshletMesh result;
+    result.m_maxVertices = std::min(std::max<size_t>(maxVertices, 3), MAX_VERTICES_LIMIT);
+    result.m_maxTriangles = std::max<size_t>(maxTriangles, 1);
+
+    const size_t vertexCount = mesh.GetVertexCount();
+    const size_t triangleCount = mesh.GetTriangleCount();
+    const std::vector<uint32_t> indices(mesh.indices.begin(), mesh.indices.begin() + triangleCount * 3);
+    for (uint32_t index : indices) {
+        if (index >= vertexCount) {
+            return result;
+        }
+    }
+
+    std::vector<Vector3> positions(vertexCount);
+    for (size_t i = 0; i < vertexCount; ++i) {
+        positions[i] = mesh.GetPosition(i);
+    }
+    std::vector<Vector3> centroids(triangleCount);
+    for (size_t t = 0; t < triangleCount; ++t) {
+        centroids[t] = (positions[indices[t * 3]] + positions[indices[t * 3 + 1]] + positions[indices[t * 3 + 2]]) /
+                       3.0f;
+    }
+
+    MeshletAdjacency adjacency = BuildAdjacency(indices, vertexCount);
+    std::vector<bool> emitted(triangleCount, false);
+    std::vector<uint32_t> localIndex(vertexCount, NO_INDEX);
+    const size_t vertexLimit = result.m_maxVertices;
+    const size_t triangleLimit = result.m_maxTriangles;
+
+    Meshlet current;
+    Vector3 centroidSum = Vector3::Zero;
+    size_t seedCursor = 0;
+    uint32_t lastTriangle = NO_INDEX;
+
+    auto newVertices = [&](uint32_t triangle) {
+        uint32_t count = 0;
+        for (int k = 0; k < 3; ++k) {
+            count += localIndex[indices[triangle * 3 + k]] == NO_INDEX ? 1 : 0;
+        }
+        return count;
+    };
+
+    auto bestNeighbour = [&](const uint32_t* seeds, size_t seedCount) {
+        uint32_t best = NO_INDEX;
+        uint32_t bestExtra = UINT32_MAX;
+        float bestDistance = 0.0f;
+        Vector3 centroid = current.triangleCount > 0 ? centroidSum / static_cast<float>(current.triangleCount)
+                                                     : Vector3::Zero;
+        for (size_t s = 0; s < seedCount; ++s) {
+            uint32_t vertex = seeds[s];
+            for (uint32_t a = adjacency.offsets[vertex]; a < adjacency.offsets[vertex + 1]; ++a) {
+                uint32_t triangle = adjacency.triangles[a];
+                if (emitted[triangle]) {
+                    continue;
+                }
+                uint32_t extra = newVertices(triangle);
+                if (current.vertexCount + extra > vertexLimit) {
+                    continue;
+                }
+                if (extra > 0) {
+                    bool closesVertex = false;
+                    for (int k = 0; k < 3; ++k) {
+                        closesVertex |= adjacency.liveCounts[indices[triangle * 3 + k]] == 1;
+                    }
+                    extra = closesVertex ? 1 : extra + 1;
+                }
+                float distance = (centroids[triangle] - centroid).LengthSquared();
+                if (extra < bestExtra || (extra == bestExtra && distance < bestDistance)) {
+                    best = triangle;
+                    bestExtra = extra;
+                    bestDistance = distance;
+                }
+            }
+        }
+        return best;
+    };
+
+    auto finishMeshlet = [&]() {
+        if (current.triangleCount == 0) {
+            return;
+        }
+        ComputeMeshletBounds(current, result, positions);
+        for (uint32_t i = 0; i < current.vertexCount; ++i) {
+            localIndex[result.vertices[current.vertexOffset + i]] = NO_INDEX;
+        }
+        result.meshlets.push_back(current);
+        current = Meshlet();
+        current.vertexOffset = static_cast<uint32_t>(result.vertices.size());
+        current.triangleOffset = static_cast<uint32_t>(result.triangles.size() / 3);
+        centroidSum = Vector3::Zero;
+    };
+
+    auto nextSeed = [&]() {
+        uint32_t best = NO_INDEX;
+        uint32_t bestLive = UINT32_MAX;
+        if (!result.meshlets.empty()) {
+            const Meshlet& previous = result.meshlets.back();
+            for (uint32_t i = 0; i < previous.vertexCount; ++i) {
+                uint32_t vertex = result.vertices[previous.vertexOffset + i];
+                for (uint32_t a = adjacency.offsets[vertex]; a < adjacency.offsets[vertex + 1]; ++a) {
+                    uint32_t triangle = adjacency.triangles[a];
+                    if (emitted[triangle]) {
+                        continue;
+                    }
+                    uint32_t live = adjacency.liveCounts[indices[triangle * 3]] +
+                                    adjacency.liveCounts[indices[triangle * 3 + 1]] +
+                                    adjacency.liveCounts[indices[triangle * 3 + 2]];
+                    if (live < bestLive) {
+                        best = triangle;
+                        bestLive = live;
+                    }
+                }
+            }
+        }
+        if (best != NO_INDEX) {
+            return best;
+        }
+        while (seedCursor < triangleCount && emitted[seedCursor]) {
+            seedCursor++;
+        }
+        return seedCursor < triangleCount ? static_cast<uint32_t>(seedCursor) : NO_INDEX;
+    };
+
+    for (size_t processed = 0; processed < triangleCount; ++processed) {
+        uint32_t triangle = NO_INDEX;
+        if (current.triangleCount > 0 && current.triangleCount < triangleLimit) {
+            triangle = bestNeighbour(indices.data() + lastTriangle * 3, 3);
+            if (triangle == NO_INDEX) {
+                triangle = bestNeighbour(result.vertices.data() + current.vertexOffset, current.vertexCount);
+            }
+        }
+        if (triangle == NO_INDEX) {
+            finishMeshlet();
+            triangle = nextSeed();
+        }
+
+        for (int k = 0; k < 3; ++k) {
+            uint32_t vertex = indices[triangle * 3 + k];
+            if (localIndex[vertex] == NO_INDEX) {
+                localIndex[vertex] = current.vertexCount++;
+                result.vertices.push_back(vertex);
+            }
+            result.triangles.push_back(static_cast<uint8_t>(localIndex[vertex]));
+            adjacency.liveCounts[vertex]--;
+        }
+        emitted[triangle] = true;
+        centroidSum += centroids[triangle];
+        current.triangleCount++;
+        lastTriangle = triangle;
+    }
+    finishMeshlet();
+
+    return result;
+}
+
+size_t MeshletMesh::Cull(const Frustum& frustum, const Vector3* cameraPosition,
+                         std::vector<uint32_t>& visible) const {
+    visible.clear();
+    for (size_t i = 0; i < meshlets.size(); ++i) {
+        const Meshlet& meshlet = meshlets[i];
+        if (cameraPosition && meshlet.IsBackFacing(*cameraPosition)) {
+            continue;
+        }
+        if (!meshlet.IsVisible(frustum)) {
+            continue;
+        }
+        visible.push_back(static_cast<uint32_t>(i));
+    }
+    return visible.size();
+}
+
+}
@@ -0,0 +1,155 @@
+#include "Geometry/PackedMesh.h"
+#include "Math3D/MathUtils.h"
+#include <algorithm>
+#include <cmath>
+
+using Math3D::MathUtils;
+using Math3D::Vector3;
+
+namespace Geometry {
+
+namespace {
+
+const float SNORM8_SCALE = 127.0f;
+
+float SignNotZero(float value) {
+    return value >= 0.0f ? 1.0f : -1.0f;
+}
+
+void WrapOctahedron(float& x, float& y) {
+    float wrappedX = (1.0f - std::fabs(y)) * SignNotZero(x);
+    float wrappedY = (1.0f - std::fabs(x)) * SignNotZero(y);
+    x = wrappedX;
+    y = wrappedY;
+}
+
+int8_t ToSnorm8(float value) {
+    return static_cast<int8_t>(MathUtils::Clamp(value, -SNORM8_SCALE, SNORM8_SCALE));
+}
+
+uint16_t Quantize(float value, float min, float scale) {
+    float level = std::round((value - min) * scale);
+    return static_cast<uint16_t>(MathUtils::Clamp(level, 0.0f, PackedMesh::POSITION_LEVELS));
+}
+
+}
+
+void PackedVertex::EncodeDirection(const Vector3& direction, int8_t out[2]) {
+    float sum = std::fabs(direction.x) + std::fabs(direction.y) + std::fabs(direction.z);
+    if (!(sum > 0.0f)) {
+        out[0] = 0;
+        out[1] = 0;
+        return;
+    }
+
+    float x = direction.x / sum;
+    float y = direction.y / sum;
+    if (direction.z < 0.0f) {
+        WrapOctahedron(x, y);
+    }
+
+    Vector3 target = direction.Normalized();
+    float baseX = std::floor(x * SNORM8_SCALE);
+    float baseY = std::floor(y * SNORM8_SCALE);
+    float bestDot = -2.0f;
+    for (int candidate = 0; candidate < 4; ++candidate) {
+        int8_t encoded[2] = { ToSnorm8(baseX + static_cast<float>(candidate & 1)),
+                              ToSnorm8(baseY + static_cast<float>(candidate >> 1)) };
+        float dot = DecodeDirection(encoded).Dot(target);
+        if (dot > bestDot) {
+            bestDot = dot;
+            out[0] = encoded[0];
+            out[1] = encoded[1];
+        }
+    }
+}
+
+Vector3 PackedVertex::DecodeDirection(const int8_t in[2]) {
+    float x = static_cast<float>(in[0]) / SNORM8_SCALE;
+    float y = static_cast<float>(in[1]) / SNORM8_SCALE;
+    float z = 1.0f - std::fabs(x) - std::fabs(y);
+    if (z < 0.0f) {
+        WrapOctahedron(x, y);
+    }
+    return Vector3(x, y, z).Normalized();
+}
+
+PackedMesh PackedMesh::Encode(const Mesh& mesh) {
+    PackedMesh packed;
+    packed.indices = mesh.indices;
+
+    const size_t vertexCount = mesh.GetVertexCount();
+    for (size_t i = 0; i < vertexCount; ++i) {
+        packed.bounds.Expand(mesh.GetVertex(i).position);
+    }
+    if (!packed.bounds.IsValid()) {
+        return packed;
+    }
+
+    Vector3 extent = packed.bounds.GetSize();
+    Vector3 scale(extent.x > 0.0f ? POSITION_LEVELS / extent.x : 0.0f,
+                  extent.y > 0.0f ? POSITION_LEVELS / extent.y : 0.0f,
+                  extent.z > 0.0f ? POSITION_LEVELS / extent.z : 0.0f);
+    const Vector3& min = packed.bounds.min;
+
+    packed.vertices.resize(vertexCount);
+    for (size_t i = 0; i < vertexCount; ++i) {
+        Vertex vertex = mesh.GetVertex(i);
+        PackedVertex& out = packed.vertices[i];
+
+        out.position[0] = Quantize(vertex.position.x, min.x, scale.x);
+        out.position[1] = Quantize(vertex.position.y, min.y, scale.y);
+        out.position[2] = Quantize(vertex.position.z, min.z, scale.z);
+
+        PackedVertex::EncodeDirection(vertex.normal, out.normal);
+        PackedVertex::EncodeDirection(vertex.tangent, out.tangent);
+        out.bitangentSign = vertex.normal.Cross(vertex.tangent).Dot(vertex.bitangent) < 0.0f ? -1 : 1;
+
+        out.texCoord[0] = MathUtils::FloatToHalf(vertex.texCoord.x);
+        out.texCoord[1] = MathUtils::FloatToHalf(vertex.texCoord.y);
+    }
+    return packed;
+}
+
+Mesh PackedMesh::Decode() const {
+    std::vector<Vertex> decoded(vertices.size());
+    for (size_t i = 0; i < vertices.size(); ++i) {
+        decoded[i] = DecodeVertex(i);
+    }
+    return Mesh(decoded, indices);
+}
+
+Vertex PackedMesh::DecodeVertex(size_t index) const {
+    const PackedVertex& packed = vertices[index];
+    Vector3 normal = PackedVertex::DecodeDirection(packed.normal);
+    Vector3 tangent = PackedVertex::DecodeDirection(packed.tangent);
+    Vector3 bitangent = normal.Cross(tangent) * static_cast<float>(packed.bitangentSign);
+    Math3D::Vector2 texCoord(MathUtils::HalfToFloat(packed.texCoord[0]), MathUtils::HalfToFloat(packed.texCoord[1]));
+    return Vertex(DecodePosition(index), normal, tangent, bitangent, texCoord);
+}
+
+Vector3 PackedMesh::DecodePosition(size_t index) const {
+    const uint16_t* position = vertices[index].position;
+    Vector3 step = GetPositionStep();
+    return Vector3(bounds.min.x + static_cast<float>(position[0]) * step.x,
+                   bounds.min.y + static_cast<float>(position[1]) * step.y,
+                   bounds.min.z + static_cast<float>(position[2]) * step.z);
+}
+
+Vector3 PackedMesh::GetPositionStep() const {
+    if (!bounds.IsValid()) {
+        return Vector3::Zero;
+    }
+    return bounds.GetSize() / POSITION_LEVELS;
+}
+
+Math3D::Matrix4 PackedMesh::GetDequantizationMatrix() const {
+    Vector3 origin = bounds.IsValid() ? bounds.min : Vector3::Zero;
+    return Math3D::Matrix4::Translation(origin) * Math3D::Matrix4::Scaling(GetPositionStep());
+}
+
+bool PackedMesh::IsValid() const {
+    return !vertices.empty() && (indices.empty() || (indices.size() % 3 == 0));
+}
+
+}
@@ -0,0 +1,67 @@
+#include "Geometry/VertexStreams.h"
+
+namespace Geometry {
+
+VertexStreams::VertexStreams(const Vertex* vertices, size_t count) {
+    Assign(vertices, count);
+}
+
+void VertexStreams::Resize(size_t count) {
+    positions.Resize(count);
+    normals.Resize(count);
+    tangents.Resize(count);
+    bitangents.Resize(count);
+    texCoords.resize(count);
+}
+
+void VertexStreams::Reserve(size_t count) {
+    positions.Reserve(count);
+    normals.Reserve(count);
+    tangents.Reserve(count);
+    bitangents.Reserve(count);
+    texCoords.reserve(count);
+}
+
+void VertexStreams::Clear() {
+    positions.Clear();
+    normals.Clear();
+    tangents.Clear();
+    bitangents.Clear();
+    texCoords.clear();
+}
+
+void VertexStreams::PushBack(const Vertex& vertex) {
+    positions.PushBack(vertex.position);
+    normals.PushBack(vertex.normal);
+    tangents.PushBack(vertex.tangent);
+    bitangents.PushBack(vertex.bitangent);
+    texCoords.push_back(vertex.texCoord);
+}
+
+Vertex VertexStreams::Get(size_t index) const {
+    return Vertex(positions.Get(index), normals.Get(index), tangents.Get(index),
+                  bitangents.Get(index), texCoords[index]);
+}
+
+void VertexStreams::Set(size_t index, const Vertex& vertex) {
+    positions.Set(index, vertex.position);
+    normals.Set(index, vertex.normal);
+    tangents.Set(index, vertex.tangent);
+    bitangents.Set(index, vertex.bitangent);
+    texCoords[index] = vertex.texCoord;
+}
+
+void VertexStreams::Assign(const Vertex* vertices, size_t count) {
+    Resize(count);
+    for (size_t i = 0; i < count; ++i) {
+        Set(i, vertices[i]);
+    }
+}
+
+void VertexStreams::CopyTo(Vertex* out) const {
+    for (size_t i = 0; i < Size(); ++i) {
+        out[i] = Get(i);
+    }
+}
+
+}
@@ -0,0 +1,16 @@
+#include "Math3D/AffineTransform.h"
+
+namespace Math3D {
+
+void AffineTransform::Propagate(const int* parentIndices, const AffineTransform* locals, AffineTransform* worlds, size_t count) {
+    for (size_t i = 0; i < count; ++i) {
+        int parent = parentIndices[i];
+        if (parent < 0 || static_cast<size_t>(parent) >= i) {
+            worlds[i] = locals[i];
+        } else {
+            worlds[i] = worlds[parent] * locals[i];
+        }
+    }
+}
+
+}
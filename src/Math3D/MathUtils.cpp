@@ -1,38 +1,250 @@
 #include "Math3D/MathUtils.h"
+#include "Math3D/SIMD.h"
 #include <cmath>
+#include <cstring>
+
+#if defined(TERM3D_X86_SIMD)
+#include <immintrin.h>
+#endif
 
 namespace Math3D {
 
-const float MathUtils::PI = 3.14159265358979323846f;
-const float MathUtils::DEG_TO_RAD = PI / 180.0f;
-const float MathUtils::RAD_TO_DEG = 180.0f / PI;
-const float MathUtils::EPSILON = 1e-6f;
+namespace {
+
+constexpr float TWO_OVER_PI = 0.636619772367581343f;
+constexpr float HALF_PI_A = 1.5703125f;
+constexpr float HALF_PI_B = 4.837512969970703125e-4f;
+constexpr float HALF_PI_C = 7.54978995489188216e-8f;
+
+constexpr float SIN_C1 = -1.6666654611e-1f;
+constexpr float SIN_C2 = 8.3321608736e-3f;
+constexpr float SIN_C3 = -1.9515295891e-4f;
+
+constexpr float COS_C1 = 4.166664568298827e-2f;
+constexpr float COS_C2 = -1.388731625493765e-3f;
+constexpr float COS_C3 = 2.443315711809948e-5f;
+
+constexpr size_t RING_CHUNK_SIZE = 256;
+
+struct SinCosKernels {
+    void (*sinCos)(const float* angles, float* sines, float* cosines, size_t count);
+};
+
+void SinCosOne(float angle, float& sine, float& cosine) {
+    if (!(std::fabs(angle) <= MathUtils::SINCOS_REDUCTION_LIMIT)) {
+        sine = std::sin(angle);
+        cosine = std::cos(angle);
+        return;
+    }
+
+    float j = std::nearbyint(angle * TWO_OVER_PI);
+    float r = ((angle - j * HALF_PI_A) - j * HALF_PI_B) - j * HALF_PI_C;
+    float r2 = r * r;
+
+    float s = ((SIN_C3 * r2 + SIN_C2) * r2 + SIN_C1) * r2;
+    s = s * r + r;
+    float c = ((COS_C3 * r2 + COS_C2) * r2 + COS_C1) * r2;
+    c = c * r2 - 0.5f * r2 + 1.0f;
+
+    int quadrant = static_cast<int>(j);
+    if (quadrant & 1) {
+        float swap = s;
+        s = c;
+        c = swap;
+    }
+    sine = (quadrant & 2) ? -s : s;
+    cosine = ((quadrant + 1) & 2) ? -c : c;
+}
+
+void SinCosScalar(const float* angles, float* sines, float* cosines, size_t count) {
+    for (size_t i = 0; i < count; ++i) {
+        SinCosOne(angles[i], sines[i], cosines[i]);
+    }
+}
+
+#if defined(TERM3D_X86_SIMD)
+
+TERM3D_TARGET_SSE2 void SinCosSSE(const float* angles, float* sines, float* cosines, size_t count) {
+    const __m128 twoOverPi = _mm_set1_ps(TWO_OVER_PI);
+    const __m128 absMask = _mm_castsi128_ps(_mm_set1_epi32(0x7FFFFFFF));
+    const __m128 limit = _mm_set1_ps(MathUtils::SINCOS_REDUCTION_LIMIT);
+    const __m128i one = _mm_set1_epi32(1);
+    const __m128i two = _mm_set1_epi32(2);
+
+    size_t i = 0;
+    for (; i + 4 <= count; i += 4) {
+        __m128 x = _mm_loadu_ps(angles + i);
+        __m128i q = _mm_cvtps_epi32(_mm_mul_ps(x, twoOverPi));
+        __m128 j = _mm_cvtepi32_ps(q);
+
+        __m128 r = _mm_sub_ps(_mm_sub_ps(_mm_sub_ps(x, _mm_mul_ps(j, _mm_set1_ps(HALF_PI_A))),
+                                         _mm_mul_ps(j, _mm_set1_ps(HALF_PI_B))),
+                              _mm_mul_ps(j, _mm_set1_ps(HALF_PI_C)));
+        __m128 r2 = _mm_mul_ps(r, r);
+
+        __m128 s = _mm_add_ps(_mm_mul_ps(_mm_set1_ps(SIN_C3), r2), _mm_set1_ps(SIN_C2));
+        s = _mm_add_ps(_mm_mul_ps(s, r2), _mm_set1_ps(SIN_C1));
+        s = _mm_mul_ps(s, r2);
+        s = _mm_add_ps(_mm_mul_ps(s, r), r);
+
+        __m128 c = _mm_add_ps(_mm_mul_ps(_mm_set1_ps(COS_C3), r2), _mm_set1_ps(COS_C2));
+        c = _mm_add_ps(_mm_mul_ps(c, r2), _mm_set1_ps(COS_C1));
+        c = _mm_mul_ps(c, r2);
+        c = _mm_add_ps(_mm_sub_ps(_mm_mul_ps(c, r2), _mm_mul_ps(_mm_set1_ps(0.5f), r2)), _mm_set1_ps(1.0f));
+
+        __m128 swap = _mm_castsi128_ps(_mm_cmpeq_epi32(_mm_and_si128(q, one), one));
+        __m128 sinSign = _mm_castsi128_ps(_mm_slli_epi32(_mm_and_si128(q, two), 30));
+        __m128 cosSign = _mm_castsi128_ps(_mm_slli_epi32(_mm_and_si128(_mm_add_epi32(q, one), two), 30));
+
+        __m128 sine = _mm_or_ps(_mm_and_ps(swap, c), _mm_andnot_ps(swap, s));
+        __m128 cosine = _mm_or_ps(_mm_and_ps(swap, s), _mm_andnot_ps(swap, c));
+        _mm_storeu_ps(sines + i, _mm_xor_ps(sine, sinSign));
+        _mm_storeu_ps(cosines + i, _mm_xor_ps(cosine, cosSign));
 
-float MathUtils::Radians(float degrees) {
-    return degrees * DEG_TO_RAD;
+        if (_mm_movemask_ps(_mm_cmpnle_ps(_mm_and_ps(x, absMask), limit))) {
+            SinCosScalar(angles + i, sines + i, cosines + i, 4);
+        }
+    }
+    SinCosScalar(angles + i, sines + i, cosines + i, count - i);
 }
 
-float MathUtils::Degrees(float radians) {
-    return radians * RAD_TO_DEG;
+TERM3D_TARGET_AVX2 void SinCosAVX2(const float* angles, float* sines, float* cosines, size_t count) {
+    const __m256 twoOverPi = _mm256_set1_ps(TWO_OVER_PI);
+    const __m256 absMask = _mm256_castsi256_ps(_mm256_set1_epi32(0x7FFFFFFF));
+    const __m256 limit = _mm256_set1_ps(MathUtils::SINCOS_REDUCTION_LIMIT);
+    const __m256i one = _mm256_set1_epi32(1);
+    const __m256i two = _mm256_set1_epi32(2);
+
+    size_t i = 0;
+    for (; i + 8 <= count; i += 8) {
+        __m256 x = _mm256_loadu_ps(angles + i);
+        __m256i q = _mm256_cvtps_epi32(_mm256_mul_ps(x, twoOverPi));
+        __m256 j = _mm256_cvtepi32_ps(q);
+
+        __m256 r = _mm256_sub_ps(_mm256_sub_ps(_mm256_sub_ps(x, _mm256_mul_ps(j, _mm256_set1_ps(HALF_PI_A))),
+                                               _mm256_mul_ps(j, _mm256_set1_ps(HALF_PI_B))),
+                                 _mm256_mul_ps(j, _mm256_set1_ps(HALF_PI_C)));
+        __m256 r2 = _mm256_mul_ps(r, r);
+
+        __m256 s = _mm256_add_ps(_mm256_mul_ps(_mm256_set1_ps(SIN_C3), r2), _mm256_set1_ps(SIN_C2));
+        s = _mm256_add_ps(_mm256_mul_ps(s, r2), _mm256_set1_ps(SIN_C1));
+        s = _mm256_mul_ps(s, r2);
+        s = _mm256_add_ps(_mm256_mul_ps(s, r), r);
+
+        __m256 c = _mm256_add_ps(_mm256_mul_ps(_mm256_set1_ps(COS_C3), r2), _mm256_set1_ps(COS_C2));
+        c = _mm256_add_ps(_mm256_mul_ps(c, r2), _mm256_set1_ps(COS_C1));
+        c = _mm256_mul_ps(c, r2);
+        c = _mm256_add_ps(_mm256_sub_ps(_mm256_mul_ps(c, r2), _mm256_mul_ps(_mm256_set1_ps(0.5f), r2)), _mm256_set1_ps(1.0f));
+
+        __m256 swap = _mm256_castsi256_ps(_mm256_cmpeq_epi32(_mm256_and_si256(q, one), one));
+        __m256 sinSign = _mm256_castsi256_ps(_mm256_slli_epi32(_mm256_and_si256(q, two), 30));
+        __m256 cosSign = _mm256_castsi256_ps(_mm256_slli_epi32(_mm256_and_si256(_mm256_add_epi32(q, one), two), 30));
+
+        _mm256_storeu_ps(sines + i, _mm256_xor_ps(_mm256_blendv_ps(s, c, swap), sinSign));
+        _mm256_storeu_ps(cosines + i, _mm256_xor_ps(_mm256_blendv_ps(c, s, swap), cosSign));
+
+        __m256 outOfRange = _mm256_cmp_ps(_mm256_and_ps(x, absMask), limit, _CMP_NLE_UQ);
+        if (_mm256_movemask_ps(outOfRange)) {
+            SinCosScalar(angles + i, sines + i, cosines + i, 8);
+        }
+    }
+    SinCosSSE(angles + i, sines + i, cosines + i, count - i);
 }
 
-float MathUtils::Clamp(float value, float min, float max) {
-    if (value < min) return min;
-    if (value > max) return max;
-    return value;
+#endif
+
+SinCosKernels SelectKernels() {
+    SinCosKernels kernels = { SinCosScalar };
+#if defined(TERM3D_X86_SIMD)
+    SIMDLevel level = SIMD::GetLevel();
+    if (level >= SIMDLevel::AVX2) {
+        kernels.sinCos = SinCosAVX2;
+    } else if (level >= SIMDLevel::SSE2) {
+        kernels.sinCos = SinCosSSE;
+    }
+#endif
+    return kernels;
 }
 
-float MathUtils::Lerp(float a, float b, float t) {
-    return a + (b - a) * t;
+const SinCosKernels& GetKernels() {
+    static const SinCosKernels kernels = SelectKernels();
+    return kernels;
 }
 
-float MathUtils::SmoothStep(float edge0, float edge1, float x) {
-    x = Clamp((x - edge0) / (edge1 - edge0), 0.0f, 1.0f);
-    return x * x * (3.0f - 2.0f * x);
 }
 
-bool MathUtils::Approximately(float a, float b, float epsilon) {
-    return std::abs(a - b) <= epsilon;
+void MathUtils::SinCos(float angle, float& sine, float& cosine) {
+    SinCosOne(angle, sine, cosine);
 }
 
-} 
+void MathUtils::SinCosBatch(const float* angles, float* sines, float* cosines, size_t count) {
+    GetKernels().sinCos(angles, sines, cosines, count);
+}
+
+void MathUtils::SinCosRing(float start, float step, size_t count, float* sines, float* cosines) {
+    float angles[RING_CHUNK_SIZE];
+    for (size_t begin = 0; begin < count; begin += RING_CHUNK_SIZE) {
+        size_t chunk = count - begin < RING_CHUNK_SIZE ? count - begin : RING_CHUNK_SIZE;
+        for (size_t i = 0; i < chunk; ++i) {
+            angles[i] = start + static_cast<float>(begin + i) * step;
+        }
+        SinCosBatch(angles, sines + begin, cosines + begin, chunk);
+    }
+}
+
+uint16_t MathUtils::FloatToHalf(float value) {
+    uint32_t bits;
+    std::memcpy(&bits, &value, sizeof(bits));
+    uint32_t sign = (bits >> 16) & 0x8000u;
+    uint32_t magnitude = bits & 0x7FFFFFFFu;
+
+    if (magnitude >= 0x7F800000u) {
+        return static_cast<uint16_t>(sign | 0x7C00u | (magnitude > 0x7F800000u ? 0x0200u : 0u));
+    }
+    if (magnitude >= 0x477FF000u) {
+        return static_cast<uint16_t>(sign | 0x7C00u);
+    }
+    if (magnitude < 0x38800000u) {
+        if (magnitude <= 0x33000000u) {
+            return static_cast<uint16_t>(sign);
+        }
+        uint32_t mantissa = (magnitude & 0x7FFFFFu) | 0x800000u;
+        uint32_t shift = 126u - (magnitude >> 23);
+        uint32_t half = mantissa >> shift;
+        uint32_t remainder = mantissa & ((1u << shift) - 1u);
+        uint32_t halfway = 1u << (shift - 1u);
+        if (remainder > halfway || (remainder == halfway && (half & 1u))) {
+            half++;
+        }
+        return static_cast<uint16_t>(sign | half);
+    }
+
+    uint32_t half = (magnitude - 0x38000000u) >> 13;
+    uint32_t remainder = magnitude & 0x1FFFu;
+    if (remainder > 0x1000u || (remainder == 0x1000u && (half & 1u))) {
+        half++;
+    }
+    return static_cast<uint16_t>(sign | half);
+}
+
+float MathUtils::HalfToFloat(uint16_t value) {
+    uint32_t sign = static_cast<uint32_t>(value & 0x8000u) << 16;
+    uint32_t exponent = (value >> 10) & 0x1Fu;
+    uint32_t mantissa = value & 0x3FFu;
+
+    uint32_t bits;
+    if (exponent == 0) {
+        float subnormal = std::ldexp(static_cast<float>(mantissa), -24);
+        return sign ? -subnormal : subnormal;
+    } else if (exponent == 0x1Fu) {
+        bits = sign | 0x7F800000u | (mantissa << 13);
+    } else {
+        bits = sign | ((exponent + 112u) << 23) | (mantissa << 13);
+    }
+
+    float result;
+    std::memcpy(&result, &bits, sizeof(result));
+    return result;
+}
+
+}
@@ -1,175 +1,74 @@
 #include "Math3D/Matrix4.h"
-#include "Math3D/Matrix3.h"  
-#include "Math3D/MathUtils.h"
+#include "Math3D/Matrix3.h"
+#include "Math3D/Quaternion.h"
+#include "Matrix4Kernels.h"
 #include <cmath>
-#include <cstring>
 
 namespace Math3D {
 
-Matrix4::Matrix4() {
-    std::memset(m, 0, 16 * sizeof(float));
-}
+static_assert(sizeof(Vector3) == 3 * sizeof(float), "Vector3 must be tightly packed for batch transforms");
+static_assert(sizeof(Matrix4) == 16 * sizeof(float), "Matrix4 must be tightly packed for batch inversion");
 
-Matrix4::Matrix4(const float data[16]) {
-    std::memcpy(m, data, 16 * sizeof(float));
-}
+namespace {
 
-float& Matrix4::operator()(int row, int col) {
-    return m[col * 4 + row];
-}
+constexpr size_t TRS_CHUNK_SIZE = 256;
 
-float Matrix4::operator()(int row, int col) const {
-    return m[col * 4 + row];
-}
-
-Matrix4 Matrix4::operator+(const Matrix4& other) const {
-    Matrix4 result;
-    for (int i = 0; i < 16; ++i) {
-        result.m[i] = m[i] + other.m[i];
-    }
-    return result;
-}
+Matrix3 EulerRotation(const float* sines, const float* cosines) {
+    float sx = sines[0], sy = sines[1], sz = sines[2];
+    float cx = cosines[0], cy = cosines[1], cz = cosines[2];
 
-Matrix4 Matrix4::operator-(const Matrix4& other) const {
-    Matrix4 result;
-    for (int i = 0; i < 16; ++i) {
-        result.m[i] = m[i] - other.m[i];
-    }
+    Matrix3 result;
+    result(0, 0) = cy * cz + sy * sx * sz;
+    result(0, 1) = sy * sx * cz - cy * sz;
+    result(0, 2) = sy * cx;
+    result(1, 0) = cx * sz;
+    result(1, 1) = cx * cz;
+    result(1, 2) = -sx;
+    result(2, 0) = cy * sx * sz - sy * cz;
+    result(2, 1) = sy * sz + cy * sx * cz;
+    result(2, 2) = cy * cx;
     return result;
 }
 
-Matrix4 Matrix4::operator*(const Matrix4& other) const {
-    Matrix4 result;
-    for (int col = 0; col < 4; ++col) {
-        for (int row = 0; row < 4; ++row) {
-            float sum = 0.0f;
-            for (int k = 0; k < 4; ++k) {
-                sum += (*this)(row, k) * other(k, col);
-            }
-            result(row, col) = sum;
+void ComposeTRS(const Vector3& translation, const Matrix3& rotation, const Vector3& scale, Matrix4& out) {
+    const float axisScale[3] = { scale.x, scale.y, scale.z };
+    for (int col = 0; col < 3; ++col) {
+        for (int row = 0; row < 3; ++row) {
+            out(row, col) = rotation(row, col) * axisScale[col];
         }
+        out(3, col) = 0.0f;
     }
-    return result;
+    out(0, 3) = translation.x;
+    out(1, 3) = translation.y;
+    out(2, 3) = translation.z;
+    out(3, 3) = 1.0f;
 }
 
-Vector4 Matrix4::operator*(const Vector4& vector) const {
-    return Vector4(
-        m[0] * vector.x + m[4] * vector.y + m[8] * vector.z + m[12] * vector.w,
-        m[1] * vector.x + m[5] * vector.y + m[9] * vector.z + m[13] * vector.w,
-        m[2] * vector.x + m[6] * vector.y + m[10] * vector.z + m[14] * vector.w,
-        m[3] * vector.x + m[7] * vector.y + m[11] * vector.z + m[15] * vector.w
-    );
 }
 
-Matrix4 Matrix4::operator*(float scalar) const {
+Matrix4 Matrix4::operator*(const Matrix4& other) const {
     Matrix4 result;
-    for (int i = 0; i < 16; ++i) {
-        result.m[i] = m[i] * scalar;
-    }
+    Detail::GetMatrix4Kernels().multiply(m, other.m, result.m);
     return result;
 }
 
-Matrix4& Matrix4::operator+=(const Matrix4& other) {
-    for (int i = 0; i < 16; ++i) {
-        m[i] += other.m[i];
-    }
-    return *this;
-}
-
-Matrix4& Matrix4::operator-=(const Matrix4& other) {
-    for (int i = 0; i < 16; ++i) {
-        m[i] -= other.m[i];
-    }
-    return *this;
-}
-
-Matrix4& Matrix4::operator*=(const Matrix4& other) {
-    *this = *this * other;
-    return *this;
-}
-
-Matrix4& Matrix4::operator*=(float scalar) {
-    for (int i = 0; i < 16; ++i) {
-        m[i] *= scalar;
-    }
-    return *this;
-}
-
-bool Matrix4::operator==(const Matrix4& other) const {
-    for (int i = 0; i < 16; ++i) {
-        if (!MathUtils::Approximately(m[i], other.m[i])) {
-            return false;
-        }
-    }
-    return true;
-}
-
-bool Matrix4::operator!=(const Matrix4& other) const {
-    return !(*this == other);
-}
-
-Matrix4 Matrix4::Transposed() const {
-    Matrix4 result;
-    for (int row = 0; row < 4; ++row) {
-        for (int col = 0; col < 4; ++col) {
-            result(row, col) = (*this)(col, row);
-        }
-    }
-    return result;
+void Matrix4::TransformPoints(const Vector3* in, Vector3* out, size_t count) const {
+    Detail::GetMatrix4Kernels().transformPoints(m, reinterpret_cast<const float*>(in), reinterpret_cast<float*>(out), count);
 }
 
-float Matrix4::Determinant() const {
-    float det = 0.0f;
-    det += m[0] * (m[5] * (m[10] * m[15] - m[11] * m[14]) - 
-                   m[6] * (m[9] * m[15] - m[11] * m[13]) + 
-                   m[7] * (m[9] * m[14] - m[10] * m[13]));
-    
-    det -= m[1] * (m[4] * (m[10] * m[15] - m[11] * m[14]) - 
-                   m[6] * (m[8] * m[15] - m[11] * m[12]) + 
-                   m[7] * (m[8] * m[14] - m[10] * m[12]));
-    
-    det += m[2] * (m[4] * (m[9] * m[15] - m[11] * m[13]) - 
-                   m[5] * (m[8] * m[15] - m[11] * m[12]) + 
-                   m[7] * (m[8] * m[13] - m[9] * m[12]));
-    
-    det -= m[3] * (m[4] * (m[9] * m[14] - m[10] * m[13]) - 
-                   m[5] * (m[8] * m[14] - m[10] * m[12]) + 
-                   m[6] * (m[8] * m[13] - m[9] * m[12]));
-    
-    return det;
+void Matrix4::TransformDirections(const Vector3* in, Vector3* out, size_t count) const {
+    Detail::GetMatrix4Kernels().transformDirections(m, reinterpret_cast<const float*>(in), reinterpret_cast<float*>(out), count);
 }
 
-bool Matrix4::IsAffine() const {
-    return MathUtils::Approximately(m[3], 0.0f) &&
-           MathUtils::Approximately(m[7], 0.0f) &&
-           MathUtils::Approximately(m[11], 0.0f) &&
-           MathUtils::Approximately(m[15], 1.0f);
+void Matrix4::TransformPointsProjective(const Vector3* in, Vector3* out, size_t count) const {
+    Detail::GetMatrix4Kernels().transformProjective(m, reinterpret_cast<const float*>(in), reinterpret_cast<float*>(out), count);
 }
 
 Matrix4 Matrix4::FastInvertAffine() const {
-    Matrix3 rotation;
-    rotation(0, 0) = m[0]; rotation(0, 1) = m[4]; rotation(0, 2) = m[8];
-    rotation(1, 0) = m[1]; rotation(1, 1) = m[5]; rotation(1, 2) = m[9];
-    rotation(2, 0) = m[2]; rotation(2, 1) = m[6]; rotation(2, 2) = m[10];
-    
-    Vector3 translation(m[12], m[13], m[14]);
-    
-    Matrix3 invRotation = rotation.Transposed();
-    
-    Vector3 invTranslation = -(invRotation * translation);
-    
     Matrix4 result;
-    
-    result(0, 0) = invRotation(0, 0); result(0, 1) = invRotation(0, 1); result(0, 2) = invRotation(0, 2);
-    result(1, 0) = invRotation(1, 0); result(1, 1) = invRotation(1, 1); result(1, 2) = invRotation(1, 2);
-    result(2, 0) = invRotation(2, 0); result(2, 1) = invRotation(2, 1); result(2, 2) = invRotation(2, 2);
-    
-    result(0, 3) = invTranslation.x;
-    result(1, 3) = invTranslation.y;
-    result(2, 3) = invTranslation.z;
-    
-    result(3, 0) = 0.0f; result(3, 1) = 0.0f; result(3, 2) = 0.0f; result(3, 3) = 1.0f;
-    
+    if (!Detail::GetMatrix4Kernels().invertAffine(m, result.m)) {
+        return Identity();
+    }
     return result;
 }
 
@@ -178,164 +77,34 @@ Matrix4 Matrix4::Inverted() const {
         return FastInvertAffine();
     }
 
-    float inv[16];
-    
-    inv[0] = m[5]  * m[10] * m[15] - 
-             m[5]  * m[11] * m[14] - 
-             m[9]  * m[6]  * m[15] + 
-             m[9]  * m[7]  * m[14] +
-             m[13] * m[6]  * m[11] - 
-             m[13] * m[7]  * m[10];
-
-    inv[4] = -m[4]  * m[10] * m[15] + 
-              m[4]  * m[11] * m[14] + 
-              m[8]  * m[6]  * m[15] - 
-              m[8]  * m[7]  * m[14] - 
-              m[12] * m[6]  * m[11] + 
-              m[12] * m[7]  * m[10];
-
-    inv[8] = m[4]  * m[9] * m[15] - 
-             m[4]  * m[11] * m[13] - 
-             m[8]  * m[5] * m[15] + 
-             m[8]  * m[7] * m[13] + 
-             m[12] * m[5] * m[11] - 
-             m[12] * m[7] * m[9];
-
-    inv[12] = -m[4]  * m[9] * m[14] + 
-               m[4]  * m[10] * m[13] +
-               m[8]  * m[5] * m[14] - 
-               m[8]  * m[6] * m[13] - 
-               m[12] * m[5] * m[10] + 
-               m[12] * m[6] * m[9];
-
-    inv[1] = -m[1]  * m[10] * m[15] + 
-              m[1]  * m[11] * m[14] + 
-              m[9]  * m[2] * m[15] - 
-              m[9]  * m[3] * m[14] - 
-              m[13] * m[2] * m[11] + 
-              m[13] * m[3] * m[10];
-
-    inv[5] = m[0]  * m[10] * m[15] - 
-             m[0]  * m[11] * m[14] - 
-             m[8]  * m[2] * m[15] + 
-             m[8]  * m[3] * m[14] + 
-             m[12] * m[2] * m[11] - 
-             m[12] * m[3] * m[10];
-
-    inv[9] = -m[0]  * m[9] * m[15] + 
-              m[0]  * m[11] * m[13] + 
-              m[8]  * m[1] * m[15] - 
-              m[8]  * m[3] * m[13] - 
-              m[12] * m[1] * m[11] + 
-              m[12] * m[3] * m[9];
-
-    inv[13] = m[0]  * m[9] * m[14] - 
-              m[0]  * m[10] * m[13] - 
-              m[8]  * m[1] * m[14] + 
-              m[8]  * m[2] * m[13] + 
-              m[12] * m[1] * m[10] - 
-              m[12] * m[2] * m[9];
-
-    inv[2] = m[1]  * m[6] * m[15] - 
-             m[1]  * m[7] * m[14] - 
-             m[5]  * m[2] * m[15] + 
-             m[5]  * m[3] * m[14] + 
-             m[13] * m[2] * m[7] - 
-             m[13] * m[3] * m[6];
-
-    inv[6] = -m[0]  * m[6] * m[15] + 
-              m[0]  * m[7] * m[14] + 
-              m[4]  * m[2] * m[15] - 
-              m[4]  * m[3] * m[14] - 
-              m[12] * m[2] * m[7] + 
-              m[12] * m[3] * m[6];
-
-    inv[10] = m[0]  * m[5] * m[15] - 
-              m[0]  * m[7] * m[13] - 
-              m[4]  * m[1] * m[15] + 
-              m[4]  * m[3] * m[13] + 
-              m[12] * m[1] * m[7] - 
-              m[12] * m[3] * m[5];
-
-    inv[14] = -m[0]  * m[5] * m[14] + 
-               m[0]  * m[6] * m[13] + 
-               m[4]  * m[1] * m[14] - 
-               m[4]  * m[2] * m[13] - 
-               m[12] * m[1] * m[6] + 
-               m[12] * m[2] * m[5];
-
-    inv[3] = -m[1] * m[6] * m[11] + 
-              m[1] * m[7] * m[10] + 
-              m[5] * m[2] * m[11] - 
-              m[5] * m[3] * m[10] - 
-              m[9] * m[2] * m[7] + 
-              m[9] * m[3] * m[6];
-
-    inv[7] = m[0] * m[6] * m[11] - 
-             m[0] * m[7] * m[10] - 
-             m[4] * m[2] * m[11] + 
-             m[4] * m[3] * m[10] + 
-             m[8] * m[2] * m[7] - 
-             m[8] * m[3] * m[6];
-
-    inv[11] = -m[0] * m[5] * m[11] + 
-               m[0] * m[7] * m[9] + 
-               m[4] * m[1] * m[11] - 
-               m[4] * m[3] * m[9] - 
-               m[8] * m[1] * m[7] + 
-               m[8] * m[3] * m[5];
-
-    inv[15] = m[0] * m[5] * m[10] - 
-              m[0] * m[6] * m[9] - 
-              m[4] * m[1] * m[10] + 
-              m[4] * m[2] * m[9] + 
-              m[8] * m[1] * m[6] - 
-              m[8] * m[2] * m[5];
-
-    float det = m[0] * inv[0] + m[1] * inv[4] + m[2] * inv[8] + m[3] * inv[12];
-
-    if (MathUtils::Approximately(det, 0.0f)) {
-        return Identity();
-    }
-
-    det = 1.0f / det;
-
     Matrix4 result;
-    for (int i = 0; i < 16; i++) {
-        result.m[i] = inv[i] * det;
+    if (!Detail::GetMatrix4Kernels().invert(m, result.m)) {
+        return Identity();
     }
-
-    return result;
-}
-
-Matrix4 Matrix4::Identity() {
-    Matrix4 result;
-    result(0, 0) = 1.0f;
-    result(1, 1) = 1.0f;
-    result(2, 2) = 1.0f;
-    result(3, 3) = 1.0f;
-    return result;
-}
-
-Matrix4 Matrix4::Translation(const Vector3& translation) {
-    Matrix4 result = Identity();
-    result(0, 3) = translation.x;
-    result(1, 3) = translation.y;
-    result(2, 3) = translation.z;
     return result;
 }
 
-Matrix4 Matrix4::Scaling(const Vector3& scale) {
-    Matrix4 result = Identity();
-    result(0, 0) = scale.x;
-    result(1, 1) = scale.y;
-    result(2, 2) = scale.z;
-    return result;
+void Matrix4::InvertBatch(const Matrix4* in, Matrix4* out, size_t count) {
+    const Detail::Matrix4Kernels& kernels = Detail::GetMatrix4Kernels();
+    size_t i = 0;
+    if (kernels.invertBatch8) {
+        for (; i + 8 <= count; i += 8) {
+            int singular = kernels.invertBatch8(in[i].m, out[i].m);
+            for (int lane = 0; singular != 0; ++lane, singular >>= 1) {
+                if (singular & 1) {
+                    out[i + lane] = in[i + lane].Inverted();
+                }
+            }
+        }
+    }
+    for (; i < count; ++i) {
+        out[i] = in[i].Inverted();
+    }
 }
 
 Matrix4 Matrix4::RotationX(float angle) {
-    float cosA = std::cos(angle);
-    float sinA = std::sin(angle);
+    float sinA, cosA;
+    MathUtils::SinCos(angle, sinA, cosA);
     
     Matrix4 result = Identity();
     result(1, 1) = cosA;
@@ -346,8 +115,8 @@ Matrix4 Matrix4::RotationX(float angle) {
 }
 
 Matrix4 Matrix4::RotationY(float angle) {
-    float cosA = std::cos(angle);
-    float sinA = std::sin(angle);
+    float sinA, cosA;
+    MathUtils::SinCos(angle, sinA, cosA);
     
     Matrix4 result = Identity();
     result(0, 0) = cosA;
@@ -358,8 +127,8 @@ Matrix4 Matrix4::RotationY(float angle) {
 }
 
 Matrix4 Matrix4::RotationZ(float angle) {
-    float cosA = std::cos(angle);
-    float sinA = std::sin(angle);
+    float sinA, cosA;
+    MathUtils::SinCos(angle, sinA, cosA);
     
     Matrix4 result = Identity();
     result(0, 0) = cosA;
@@ -369,6 +138,43 @@ Matrix4 Matrix4::RotationZ(float angle) {
     return result;
 }
 
+Matrix4 Matrix4::FromTRS(const Vector3& translation, const Quaternion& rotation, const Vector3& scale) {
+    Matrix4 result;
+    ComposeTRS(translation, rotation.ToMatrix3(), scale, result);
+    return result;
+}
+
+Matrix4 Matrix4::FromTRS(const Vector3& translation, const Vector3& eulerAngles, const Vector3& scale) {
+    float sines[3], cosines[3];
+    MathUtils::SinCos(eulerAngles.x, sines[0], cosines[0]);
+    MathUtils::SinCos(eulerAngles.y, sines[1], cosines[1]);
+    MathUtils::SinCos(eulerAngles.z, sines[2], cosines[2]);
+
+    Matrix4 result;
+    ComposeTRS(translation, EulerRotation(sines, cosines), scale, result);
+    return result;
+}
+
+void Matrix4::FromTRSBatch(const Vector3* translations, const Quaternion* rotations, const Vector3* scales,
+                           Matrix4* out, size_t count) {
+    for (size_t i = 0; i < count; ++i) {
+        ComposeTRS(translations[i], rotations[i].ToMatrix3(), scales[i], out[i]);
+    }
+}
+
+void Matrix4::FromTRSBatch(const Vector3* translations, const Vector3* eulerAngles, const Vector3* scales,
+                           Matrix4* out, size_t count) {
+    float sines[TRS_CHUNK_SIZE * 3];
+    float cosines[TRS_CHUNK_SIZE * 3];
+    for (size_t begin = 0; begin < count; begin += TRS_CHUNK_SIZE) {
+        size_t chunk = count - begin < TRS_CHUNK_SIZE ? count - begin : TRS_CHUNK_SIZE;
+        MathUtils::SinCosBatch(reinterpret_cast<const float*>(eulerAngles + begin), sines, cosines, chunk * 3);
+        for (size_t i = 0; i < chunk; ++i) {
+            ComposeTRS(translations[begin + i], EulerRotation(sines + i * 3, cosines + i * 3), scales[begin + i], out[begin + i]);
+        }
+    }
+}
+
 Matrix4 Matrix4::Perspective(float fov, float aspect, float near, float far) {
     float tanHalfFov = std::tan(fov / 2.0f);
     
@@ -376,41 +182,26 @@ Matrix4 Matrix4::Perspective(float fov, float aspect, float near, float far) {
     result(0, 0) = 1.0f / (aspect * tanHalfFov);
     result(1, 1) = 1.0f / tanHalfFov;
     result(2, 2) = -(far + near) / (far - near);
-    result(3, 2) = -(2.0f * far * near) / (far - near);  
-    result(2, 3) = -1.0f;   
+    result(2, 3) = -(2.0f * far * near) / (far - near);
+    result(3, 2) = -1.0f;
     
     return result;
 }
 
-Matrix4 Matrix4::Orthographic(float left, float right, float bottom, float top, float near, float far) {
-    Matrix4 result = Identity();
-    result(0, 0) = 2.0f / (right - left);
-    result(1, 1) = 2.0f / (top - bottom);
-    result(2, 2) = -2.0f / (far - near);
-    result(0, 3) = -(right + left) / (right - left);
-    result(1, 3) = -(top + bottom) / (top - bottom);
-    result(2, 3) = -(far + near) / (far - near);
-    return result;
-}
-
 Matrix4 Matrix4::LookAt(const Vector3& eye, const Vector3& target, const Vector3& up) {
     Vector3 z = (eye - target).Normalized();
     Vector3 x = up.Cross(z).Normalized();
     Vector3 y = z.Cross(x);
     
     Matrix4 result = Identity();
-    result(0, 0) = x.x; result(1, 0) = x.y; result(2, 0) = x.z;  
-    result(0, 1) = y.x; result(1, 1) = y.y; result(2, 1) = y.z;  
-    result(0, 2) = z.x; result(1, 2) = z.y; result(2, 2) = z.z;  
-    result(3, 0) = -x.Dot(eye);  
-    result(3, 1) = -y.Dot(eye);  
-    result(3, 2) = -z.Dot(eye);  
+    result(0, 0) = x.x; result(0, 1) = x.y; result(0, 2) = x.z;
+    result(1, 0) = y.x; result(1, 1) = y.y; result(1, 2) = y.z;
+    result(2, 0) = z.x; result(2, 1) = z.y; result(2, 2) = z.z;
+    result(0, 3) = -x.Dot(eye);
+    result(1, 3) = -y.Dot(eye);
+    result(2, 3) = -z.Dot(eye);
     
     return result;
 }
 
-Matrix4 operator*(float scalar, const Matrix4& matrix) {
-    return matrix * scalar;
-}
-
 } 
@@ -0,0 +1,535 @@
+#include "Matrix4Kernels.h"
+#include "Math3D/MathUtils.h"
+
+#if defined(TERM3D_X86_SIMD)
+#include <immintrin.h>
+#endif
+
+namespace Math3D {
+namespace Detail {
+
+namespace {
+
+enum class BatchMode {
+    Point,
+    Direction,
+    Projective
+};
+
+void MultiplyScalar(const float* a, const float* b, float* out) {
+    for (int col = 0; col < 4; ++col) {
+        const float* bc = b + col * 4;
+        for (int row = 0; row < 4; ++row) {
+            out[col * 4 + row] = a[row] * bc[0] + a[4 + row] * bc[1] + a[8 + row] * bc[2] + a[12 + row] * bc[3];
+        }
+    }
+}
+
+bool InvertScalar(const float* m, float* out) {
+    float inv[16];
+
+    inv[0] = m[5] * m[10] * m[15] - m[5] * m[11] * m[14] - m[9] * m[6] * m[15] +
+             m[9] * m[7] * m[14] + m[13] * m[6] * m[11] - m[13] * m[7] * m[10];
+    inv[4] = -m[4] * m[10] * m[15] + m[4] * m[11] * m[14] + m[8] * m[6] * m[15] -
+              m[8] * m[7] * m[14] - m[12] * m[6] * m[11] + m[12] * m[7] * m[10];
+    inv[8] = m[4] * m[9] * m[15] - m[4] * m[11] * m[13] - m[8] * m[5] * m[15] +
+             m[8] * m[7] * m[13] + m[12] * m[5] * m[11] - m[12] * m[7] * m[9];
+    inv[12] = -m[4] * m[9] * m[14] + m[4] * m[10] * m[13] + m[8] * m[5] * m[14] -
+               m[8] * m[6] * m[13] - m[12] * m[5] * m[10] + m[12] * m[6] * m[9];
+    inv[1] = -m[1] * m[10] * m[15] + m[1] * m[11] * m[14] + m[9] * m[2] * m[15] -
+              m[9] * m[3] * m[14] - m[13] * m[2] * m[11] + m[13] * m[3] * m[10];
+    inv[5] = m[0] * m[10] * m[15] - m[0] * m[11] * m[14] - m[8] * m[2] * m[15] +
+             m[8] * m[3] * m[14] + m[12] * m[2] * m[11] - m[12] * m[3] * m[10];
+    inv[9] = -m[0] * m[9] * m[15] + m[0] * m[11] * m[13] + m[8] * m[1] * m[15] -
+              m[8] * m[3] * m[13] - m[12] * m[1] * m[11] + m[12] * m[3] * m[9];
+    inv[13] = m[0] * m[9] * m[14] - m[0] * m[10] * m[13] - m[8] * m[1] * m[14] +
+              m[8] * m[2] * m[13] + m[12] * m[1] * m[10] - m[12] * m[2] * m[9];
+    inv[2] = m[1] * m[6] * m[15] - m[1] * m[7] * m[14] - m[5] * m[2] * m[15] +
+             m[5] * m[3] * m[14] + m[13] * m[2] * m[7] - m[13] * m[3] * m[6];
+    inv[6] = -m[0] * m[6] * m[15] + m[0] * m[7] * m[14] + m[4] * m[2] * m[15] -
+              m[4] * m[3] * m[14] - m[12] * m[2] * m[7] + m[12] * m[3] * m[6];
+    inv[10] = m[0] * m[5] * m[15] - m[0] * m[7] * m[13] - m[4] * m[1] * m[15] +
+              m[4] * m[3] * m[13] + m[12] * m[1] * m[7] - m[12] * m[3] * m[5];
+    inv[14] = -m[0] * m[5] * m[14] + m[0] * m[6] * m[13] + m[4] * m[1] * m[14] -
+               m[4] * m[2] * m[13] - m[12] * m[1] * m[6] + m[12] * m[2] * m[5];
+    inv[3] = -m[1] * m[6] * m[11] + m[1] * m[7] * m[10] + m[5] * m[2] * m[11] -
+              m[5] * m[3] * m[10] - m[9] * m[2] * m[7] + m[9] * m[3] * m[6];
+    inv[7] = m[0] * m[6] * m[11] - m[0] * m[7] * m[10] - m[4] * m[2] * m[11] +
+             m[4] * m[3] * m[10] + m[8] * m[2] * m[7] - m[8] * m[3] * m[6];
+    inv[11] = -m[0] * m[5] * m[11] + m[0] * m[7] * m[9] + m[4] * m[1] * m[11] -
+               m[4] * m[3] * m[9] - m[8] * m[1] * m[7] + m[8] * m[3] * m[5];
+    inv[15] = m[0] * m[5] * m[10] - m[0] * m[6] * m[9] - m[4] * m[1] * m[10] +
+              m[4] * m[2] * m[9] + m[8] * m[1] * m[6] - m[8] * m[2] * m[5];
+
+    float det = m[0] * inv[0] + m[1] * inv[4] + m[2] * inv[8] + m[3] * inv[12];
+    if (MathUtils::Approximately(det, 0.0f)) {
+        return false;
+    }
+
+    float invDet = 1.0f / det;
+    for (int i = 0; i < 16; ++i) {
+        out[i] = inv[i] * invDet;
+    }
+    return true;
+}
+
+bool InvertAffineScalar(const float* m, float* out) {
+    const float* a = m;
+    const float* b = m + 4;
+    const float* c = m + 8;
+
+    float r0[3] = { b[1] * c[2] - b[2] * c[1], b[2] * c[0] - b[0] * c[2], b[0] * c[1] - b[1] * c[0] };
+    float r1[3] = { c[1] * a[2] - c[2] * a[1], c[2] * a[0] - c[0] * a[2], c[0] * a[1] - c[1] * a[0] };
+    float r2[3] = { a[1] * b[2] - a[2] * b[1], a[2] * b[0] - a[0] * b[2], a[0] * b[1] - a[1] * b[0] };
+
+    float det = a[0] * r0[0] + a[1] * r0[1] + a[2] * r0[2];
+    if (MathUtils::Approximately(det, 0.0f)) {
+        return false;
+    }
+
+    float invDet = 1.0f / det;
+    for (int i = 0; i < 3; ++i) {
+        out[i * 4 + 0] = r0[i] * invDet;
+        out[i * 4 + 1] = r1[i] * invDet;
+        out[i * 4 + 2] = r2[i] * invDet;
+        out[i * 4 + 3] = 0.0f;
+    }
+
+    const float* t = m + 12;
+    for (int row = 0; row < 3; ++row) {
+        out[12 + row] = -(out[row] * t[0] + out[4 + row] * t[1] + out[8 + row] * t[2]);
+    }
+    out[15] = 1.0f;
+    return true;
+}
+
+template <BatchMode Mode>
+inline void TransformOneScalar(const float* m, const float* in, float* out) {
+    float x = in[0], y = in[1], z = in[2];
+    float ox = m[0] * x + m[4] * y + m[8] * z;
+    float oy = m[1] * x + m[5] * y + m[9] * z;
+    float oz = m[2] * x + m[6] * y + m[10] * z;
+    if (Mode != BatchMode::Direction) {
+        ox = ox + m[12];
+        oy = oy + m[13];
+        oz = oz + m[14];
+    }
+    if (Mode == BatchMode::Projective) {
+        float w = m[3] * x + m[7] * y + m[11] * z + m[15];
+        ox = ox / w;
+        oy = oy / w;
+        oz = oz / w;
+    }
+    out[0] = ox;
+    out[1] = oy;
+    out[2] = oz;
+}
+
+template <BatchMode Mode>
+void TransformBatchScalar(const float* m, const float* in, float* out, size_t count) {
+    for (size_t i = 0; i < count; ++i) {
+        TransformOneScalar<Mode>(m, in + i * 3, out + i * 3);
+    }
+}
+
+#if defined(TERM3D_X86_SIMD)
+
+template <int X, int Y, int Z, int W>
+TERM3D_TARGET_SSE2 inline __m128 Shuffle(__m128 a, __m128 b) {
+    return _mm_shuffle_ps(a, b, _MM_SHUFFLE(W, Z, Y, X));
+}
+
+template <int X, int Y, int Z, int W>
+TERM3D_TARGET_SSE2 inline __m128 Swizzle(__m128 v) {
+    return _mm_shuffle_ps(v, v, _MM_SHUFFLE(W, Z, Y, X));
+}
+
+TERM3D_TARGET_SSE2 inline __m128 Mat2Mul(__m128 a, __m128 b) {
+    return _mm_add_ps(_mm_mul_ps(a, Swizzle<0, 3, 0, 3>(b)),
+                      _mm_mul_ps(Swizzle<1, 0, 3, 2>(a), Swizzle<2, 1, 2, 1>(b)));
+}
+
+TERM3D_TARGET_SSE2 inline __m128 Mat2AdjMul(__m128 a, __m128 b) {
+    return _mm_sub_ps(_mm_mul_ps(Swizzle<3, 3, 0, 0>(a), b),
+                      _mm_mul_ps(Swizzle<1, 1, 2, 2>(a), Swizzle<2, 3, 0, 1>(b)));
+}
+
+TERM3D_TARGET_SSE2 inline __m128 Mat2MulAdj(__m128 a, __m128 b) {
+    return _mm_sub_ps(_mm_mul_ps(a, Swizzle<3, 0, 3, 0>(b)),
+                      _mm_mul_ps(Swizzle<1, 0, 3, 2>(a), Swizzle<2, 1, 2, 1>(b)));
+}
+
+TERM3D_TARGET_SSE2 inline __m128 Cross(__m128 a, __m128 b) {
+    __m128 product = _mm_sub_ps(_mm_mul_ps(a, Swizzle<1, 2, 0, 3>(b)),
+                                _mm_mul_ps(Swizzle<1, 2, 0, 3>(a), b));
+    return Swizzle<1, 2, 0, 3>(product);
+}
+
+TERM3D_TARGET_SSE2 void MultiplySSE(const float* a, const float* b, float* out) {
+    __m128 a0 = _mm_loadu_ps(a);
+    __m128 a1 = _mm_loadu_ps(a + 4);
+    __m128 a2 = _mm_loadu_ps(a + 8);
+    __m128 a3 = _mm_loadu_ps(a + 12);
+
+    __m128 columns[4];
+    for (int col = 0; col < 4; ++col) {
+        const float* bc = b + col * 4;
+        __m128 sum = _mm_mul_ps(a0, _mm_set1_ps(bc[0]));
+        sum = _mm_add_ps(sum, _mm_mul_ps(a1, _mm_set1_ps(bc[1])));
+        sum = _mm_add_ps(sum, _mm_mul_ps(a2, _mm_set1_ps(bc[2])));
+        sum = _mm_add_ps(sum, _mm_mul_ps(a3, _mm_set1_ps(bc[3])));
+        columns[col] = sum;
+    }
+    for (int col = 0; col < 4; ++col) {
+        _mm_storeu_ps(out + col * 4, columns[col]);
+    }
+}
+
+TERM3D_TARGET_AVX void MultiplyAVX(const float* a, const float* b, float* out) {
+    __m256 a0 = _mm256_broadcast_ps(reinterpret_cast<const __m128*>(a));
+    __m256 a1 = _mm256_broadcast_ps(reinterpret_cast<const __m128*>(a + 4));
+    __m256 a2 = _mm256_broadcast_ps(reinterpret_cast<const __m128*>(a + 8));
+    __m256 a3 = _mm256_broadcast_ps(reinterpret_cast<const __m128*>(a + 12));
+
+    __m256 b01 = _mm256_loadu_ps(b);
+    __m256 b23 = _mm256_loadu_ps(b + 8);
+
+    __m256 c01 = _mm256_mul_ps(a0, _mm256_permute_ps(b01, 0x00));
+    c01 = _mm256_add_ps(c01, _mm256_mul_ps(a1, _mm256_permute_ps(b01, 0x55)));
+    c01 = _mm256_add_ps(c01, _mm256_mul_ps(a2, _mm256_permute_ps(b01, 0xAA)));
+    c01 = _mm256_add_ps(c01, _mm256_mul_ps(a3, _mm256_permute_ps(b01, 0xFF)));
+
+    __m256 c23 = _mm256_mul_ps(a0, _mm256_permute_ps(b23, 0x00));
+    c23 = _mm256_add_ps(c23, _mm256_mul_ps(a1, _mm256_permute_ps(b23, 0x55)));
+    c23 = _mm256_add_ps(c23, _mm256_mul_ps(a2, _mm256_permute_ps(b23, 0xAA)));
+    c23 = _mm256_add_ps(c23, _mm256_mul_ps(a3, _mm256_permute_ps(b23, 0xFF)));
+
+    _mm256_storeu_ps(out, c01);
+    _mm256_storeu_ps(out + 8, c23);
+}
+
+TERM3D_TARGET_SSE2 bool InvertSSE(const float* m, float* out) {
+    __m128 c0 = _mm_loadu_ps(m);
+    __m128 c1 = _mm_loadu_ps(m + 4);
+    __m128 c2 = _mm_loadu_ps(m + 8);
+    __m128 c3 = _mm_loadu_ps(m + 12);
+
+    __m128 a = _mm_movelh_ps(c0, c1);
+    __m128 b = _mm_movehl_ps(c1, c0);
+    __m128 c = _mm_movelh_ps(c2, c3);
+    __m128 d = _mm_movehl_ps(c3, c2);
+
+    __m128 detSub = _mm_sub_ps(
+        _mm_mul_ps(Shuffle<0, 2, 0, 2>(c0, c2), Shuffle<1, 3, 1, 3>(c1, c3)),
+        _mm_mul_ps(Shuffle<1, 3, 1, 3>(c0, c2), Shuffle<0, 2, 0, 2>(c1, c3)));
+    __m128 detA = Swizzle<0, 0, 0, 0>(detSub);
+    __m128 detB = Swizzle<1, 1, 1, 1>(detSub);
+    __m128 detC = Swizzle<2, 2, 2, 2>(detSub);
+    __m128 detD = Swizzle<3, 3, 3, 3>(detSub);
+
+    __m128 dc = Mat2AdjMul(d, c);
+    __m128 ab = Mat2AdjMul(a, b);
+    __m128 x = _mm_sub_ps(_mm_mul_ps(detD, a), Mat2Mul(b, dc));
+    __m128 w = _mm_sub_ps(_mm_mul_ps(detA, d), Mat2Mul(c, ab));
+    __m128 y = _mm_sub_ps(_mm_mul_ps(detB, c), Mat2MulAdj(d, ab));
+    __m128 z = _mm_sub_ps(_mm_mul_ps(detC, b), Mat2MulAdj(a, dc));
+
+    __m128 trace = _mm_mul_ps(ab, Swizzle<0, 2, 1, 3>(dc));
+    trace = _mm_add_ps(trace, Swizzle<2, 3, 0, 1>(trace));
+    trace = _mm_add_ps(trace, Swizzle<1, 0, 3, 2>(trace));
+
+    __m128 detM = _mm_add_ps(_mm_mul_ps(detA, detD), _mm_mul_ps(detB, detC));
+    detM = _mm_sub_ps(detM, trace);
+
+    float det = _mm_cvtss_f32(detM);
+    if (MathUtils::Approximately(det, 0.0f)) {
+        return false;
+    }
+
+    __m128 invDet = _mm_div_ps(_mm_setr_ps(1.0f, -1.0f, -1.0f, 1.0f), detM);
+    x = _mm_mul_ps(x, invDet);
+    y = _mm_mul_ps(y, invDet);
+    z = _mm_mul_ps(z, invDet);
+    w = _mm_mul_ps(w, invDet);
+
+    _mm_storeu_ps(out, Shuffle<3, 1, 3, 1>(x, y));
+    _mm_storeu_ps(out + 4, Shuffle<2, 0, 2, 0>(x, y));
+    _mm_storeu_ps(out + 8, Shuffle<3, 1, 3, 1>(z, w));
+    _mm_storeu_ps(out + 12, Shuffle<2, 0, 2, 0>(z, w));
+    return true;
+}
+
+TERM3D_TARGET_SSE2 bool InvertAffineSSE(const float* m, float* out) {
+    __m128 c0 = _mm_loadu_ps(m);
+    __m128 c1 = _mm_loadu_ps(m + 4);
+    __m128 c2 = _mm_loadu_ps(m + 8);
+    __m128 t = _mm_loadu_ps(m + 12);
+
+    __m128 r0 = Cross(c1, c2);
+    __m128 r1 = Cross(c2, c0);
+    __m128 r2 = Cross(c0, c1);
+
+    __m128 product = _mm_mul_ps(c0, r0);
+    float det = _mm_cvtss_f32(product) +
+                _mm_cvtss_f32(Swizzle<1, 1, 1, 1>(product)) +
+                _mm_cvtss_f32(Swizzle<2, 2, 2, 2>(product));
+    if (MathUtils::Approximately(det, 0.0f)) {
+        return false;
+    }
+
+    __m128 invDet = _mm_set1_ps(1.0f / det);
+    r0 = _mm_mul_ps(r0, invDet);
+    r1 = _mm_mul_ps(r1, invDet);
+    r2 = _mm_mul_ps(r2, invDet);
+    __m128 r3 = _mm_setzero_ps();
+    _MM_TRANSPOSE4_PS(r0, r1, r2, r3);
+
+    __m128 translation = _mm_mul_ps(r0, Swizzle<0, 0, 0, 0>(t));
+    translation = _mm_add_ps(translation, _mm_mul_ps(r1, Swizzle<1, 1, 1, 1>(t)));
+    translation = _mm_add_ps(translation, _mm_mul_ps(r2, Swizzle<2, 2, 2, 2>(t)));
+    translation = _mm_sub_ps(_mm_setr_ps(0.0f, 0.0f, 0.0f, 1.0f), translation);
+
+    _mm_storeu_ps(out, r0);
+    _mm_storeu_ps(out + 4, r1);
+    _mm_storeu_ps(out + 8, r2);
+    _mm_storeu_ps(out + 12, translation);
+    return true;
+}
+
+template <BatchMode Mode>
+TERM3D_TARGET_SSE2 void TransformBatchSSE(const float* m, const float* in, float* out, size_t count) {
+    const __m128 m0 = _mm_set1_ps(m[0]), m1 = _mm_set1_ps(m[1]), m2 = _mm_set1_ps(m[2]), m3 = _mm_set1_ps(m[3]);
+    const __m128 m4 = _mm_set1_ps(m[4]), m5 = _mm_set1_ps(m[5]), m6 = _mm_set1_ps(m[6]), m7 = _mm_set1_ps(m[7]);
+    const __m128 m8 = _mm_set1_ps(m[8]), m9 = _mm_set1_ps(m[9]), m10 = _mm_set1_ps(m[10]), m11 = _mm_set1_ps(m[11]);
+    const __m128 m12 = _mm_set1_ps(m[12]), m13 = _mm_set1_ps(m[13]), m14 = _mm_set1_ps(m[14]), m15 = _mm_set1_ps(m[15]);
+
+    size_t i = 0;
+    for (; i + 4 <= count; i += 4) {
+        const float* src = in + i * 3;
+        __m128 v0 = _mm_loadu_ps(src);
+        __m128 v1 = _mm_loadu_ps(src + 4);
+        __m128 v2 = _mm_loadu_ps(src + 8);
+
+        __m128 xy = Shuffle<2, 3, 1, 2>(v1, v2);
+        __m128 yz = Shuffle<1, 2, 0, 1>(v0, v1);
+        __m128 x = Shuffle<0, 3, 0, 2>(v0, xy);
+        __m128 y = Shuffle<0, 2, 1, 3>(yz, xy);
+        __m128 z = Shuffle<1, 3, 0, 3>(yz, v2);
+
+        __m128 ox = _mm_add_ps(_mm_add_ps(_mm_mul_ps(m0, x), _mm_mul_ps(m4, y)), _mm_mul_ps(m8, z));
+        __m128 oy = _mm_add_ps(_mm_add_ps(_mm_mul_ps(m1, x), _mm_mul_ps(m5, y)), _mm_mul_ps(m9, z));
+        __m128 oz = _mm_add_ps(_mm_add_ps(_mm_mul_ps(m2, x), _mm_mul_ps(m6, y)), _mm_mul_ps(m10, z));
+        if (Mode != BatchMode::Direction) {
+            ox = _mm_add_ps(ox, m12);
+            oy = _mm_add_ps(oy, m13);
+            oz = _mm_add_ps(oz, m14);
+        }
+        if (Mode == BatchMode::Projective) {
+            __m128 w = _mm_add_ps(_mm_add_ps(_mm_add_ps(_mm_mul_ps(m3, x), _mm_mul_ps(m7, y)), _mm_mul_ps(m11, z)), m15);
+            ox = _mm_div_ps(ox, w);
+            oy = _mm_div_ps(oy, w);
+            oz = _mm_div_ps(oz, w);
+        }
+
+        __m128 rxy = Shuffle<0, 2, 0, 2>(ox, oy);
+        __m128 ryz = Shuffle<1, 3, 1, 3>(oy, oz);
+        __m128 rzx = Shuffle<0, 2, 1, 3>(oz, ox);
+
+        float* dst = out + i * 3;
+        _mm_storeu_ps(dst, Shuffle<0, 2, 0, 2>(rxy, rzx));
+        _mm_storeu_ps(dst + 4, Shuffle<0, 2, 1, 3>(ryz, rxy));
+        _mm_storeu_ps(dst + 8, Shuffle<1, 3, 1, 3>(rzx, ryz));
+    }
+    for (; i < count; ++i) {
+        TransformOneScalar<Mode>(m, in + i * 3, out + i * 3);
+    }
+}
+
+template <BatchMode Mode>
+TERM3D_TARGET_AVX void TransformBatchAVX(const float* m, const float* in, float* out, size_t count) {
+    const __m256 m0 = _mm256_set1_ps(m[0]), m1 = _mm256_set1_ps(m[1]), m2 = _mm256_set1_ps(m[2]), m3 = _mm256_set1_ps(m[3]);
+    const __m256 m4 = _mm256_set1_ps(m[4]), m5 = _mm256_set1_ps(m[5]), m6 = _mm256_set1_ps(m[6]), m7 = _mm256_set1_ps(m[7]);
+    const __m256 m8 = _mm256_set1_ps(m[8]), m9 = _mm256_set1_ps(m[9]), m10 = _mm256_set1_ps(m[10]), m11 = _mm256_set1_ps(m[11]);
+    const __m256 m12 = _mm256_set1_ps(m[12]), m13 = _mm256_set1_ps(m[13]), m14 = _mm256_set1_ps(m[14]), m15 = _mm256_set1_ps(m[15]);
+
+    size_t i = 0;
+    for (; i + 8 <= count; i += 8) {
+        const float* src = in + i * 3;
+        __m256 v03 = _mm256_insertf128_ps(_mm256_castps128_ps256(_mm_loadu_ps(src)), _mm_loadu_ps(src + 12), 1);
+        __m256 v14 = _mm256_insertf128_ps(_mm256_castps128_ps256(_mm_loadu_ps(src + 4)), _mm_loadu_ps(src + 16), 1);
+        __m256 v25 = _mm256_insertf128_ps(_mm256_castps128_ps256(_mm_loadu_ps(src + 8)), _mm_loadu_ps(src + 20), 1);
+
+        __m256 xy = _mm256_shuffle_ps(v14, v25, _MM_SHUFFLE(2, 1, 3, 2));
+        __m256 yz = _mm256_shuffle_ps(v03, v14, _MM_SHUFFLE(1, 0, 2, 1));
+        __m256 x = _mm256_shuffle_ps(v03, xy, _MM_SHUFFLE(2, 0, 3, 0));
+        __m256 y = _mm256_shuffle_ps(yz, xy, _MM_SHUFFLE(3, 1, 2, 0));
+        __m256 z = _mm256_shuffle_ps(yz, v25, _MM_SHUFFLE(3, 0, 3, 1));
+
+        __m256 ox = _mm256_add_ps(_mm256_add_ps(_mm256_mul_ps(m0, x), _mm256_mul_ps(m4, y)), _mm256_mul_ps(m8, z));
+        __m256 oy = _mm256_add_ps(_mm256_add_ps(_mm256_mul_ps(m1, x), _mm256_mul_ps(m5, y)), _mm256_mul_ps(m9, z));
+        __m256 oz = _mm256_add_ps(_mm256_add_ps(_mm256_mul_ps(m2, x), _mm256_mul_ps(m6, y)), _mm256_mul_ps(m10, z));
+        if (Mode != BatchMode::Direction) {
+            ox = _mm256_add_ps(ox, m12);
+            oy = _mm256_add_ps(oy, m13);
+            oz = _mm256_add_ps(oz, m14);
+        }
+        if (Mode == BatchMode::Projective) {
+            __m256 w = _mm256_add_ps(_mm256_add_ps(_mm256_add_ps(_mm256_mul_ps(m3, x), _mm256_mul_ps(m7, y)),
+                                                   _mm256_mul_ps(m11, z)), m15);
+            ox = _mm256_div_ps(ox, w);
+            oy = _mm256_div_ps(oy, w);
+            oz = _mm256_div_ps(oz, w);
+        }
+
+        __m256 rxy = _mm256_shuffle_ps(ox, oy, _MM_SHUFFLE(2, 0, 2, 0));
+        __m256 ryz = _mm256_shuffle_ps(oy, oz, _MM_SHUFFLE(3, 1, 3, 1));
+        __m256 rzx = _mm256_shuffle_ps(oz, ox, _MM_SHUFFLE(3, 1, 2, 0));
+        __m256 r03 = _mm256_shuffle_ps(rxy, rzx, _MM_SHUFFLE(2, 0, 2, 0));
+        __m256 r14 = _mm256_shuffle_ps(ryz, rxy, _MM_SHUFFLE(3, 1, 2, 0));
+        __m256 r25 = _mm256_shuffle_ps(rzx, ryz, _MM_SHUFFLE(3, 1, 3, 1));
+
+        float* dst = out + i * 3;
+        _mm_storeu_ps(dst, _mm256_castps256_ps128(r03));
+        _mm_storeu_ps(dst + 4, _mm256_castps256_ps128(r14));
+        _mm_storeu_ps(dst + 8, _mm256_castps256_ps128(r25));
+        _mm_storeu_ps(dst + 12, _mm256_extractf128_ps(r03, 1));
+        _mm_storeu_ps(dst + 16, _mm256_extractf128_ps(r14, 1));
+        _mm_storeu_ps(dst + 20, _mm256_extractf128_ps(r25, 1));
+    }
+    if (i < count) {
+        TransformBatchSSE<Mode>(m, in + i * 3, out + i * 3, count - i);
+    }
+}
+
+TERM3D_TARGET_AVX inline void Transpose4x4AVX(__m256& r0, __m256& r1, __m256& r2, __m256& r3) {
+    __m256 t0 = _mm256_unpacklo_ps(r0, r1);
+    __m256 t1 = _mm256_unpackhi_ps(r0, r1);
+    __m256 t2 = _mm256_unpacklo_ps(r2, r3);
+    __m256 t3 = _mm256_unpackhi_ps(r2, r3);
+    r0 = _mm256_shuffle_ps(t0, t2, _MM_SHUFFLE(1, 0, 1, 0));
+    r1 = _mm256_shuffle_ps(t0, t2, _MM_SHUFFLE(3, 2, 3, 2));
+    r2 = _mm256_shuffle_ps(t1, t3, _MM_SHUFFLE(1, 0, 1, 0));
+    r3 = _mm256_shuffle_ps(t1, t3, _MM_SHUFFLE(3, 2, 3, 2));
+}
+
+TERM3D_TARGET_AVX inline __m256 Sub2x2(__m256 a, __m256 b, __m256 c, __m256 d) {
+    return _mm256_sub_ps(_mm256_mul_ps(a, b), _mm256_mul_ps(c, d));
+}
+
+TERM3D_TARGET_AVX inline __m256 Cofactor3(__m256 a, __m256 x, __m256 b, __m256 y, __m256 c, __m256 z) {
+    return _mm256_add_ps(_mm256_sub_ps(_mm256_mul_ps(a, x), _mm256_mul_ps(b, y)), _mm256_mul_ps(c, z));
+}
+
+TERM3D_TARGET_AVX int InvertBatch8AVX(const float* in, float* out) {
+    __m256 a[16];
+    for (int col = 0; col < 4; ++col) {
+        for (int j = 0; j < 4; ++j) {
+            a[col * 4 + j] = _mm256_insertf128_ps(_mm256_castps128_ps256(_mm_loadu_ps(in + j * 16 + col * 4)),
+                                                  _mm_loadu_ps(in + (j + 4) * 16 + col * 4), 1);
+        }
+        Transpose4x4AVX(a[col * 4], a[col * 4 + 1], a[col * 4 + 2], a[col * 4 + 3]);
+    }
+
+    __m256 s0 = Sub2x2(a[0], a[5], a[4], a[1]);
+    __m256 s1 = Sub2x2(a[0], a[6], a[4], a[2]);
+    __m256 s2 = Sub2x2(a[0], a[7], a[4], a[3]);
+    __m256 s3 = Sub2x2(a[1], a[6], a[5], a[2]);
+    __m256 s4 = Sub2x2(a[1], a[7], a[5], a[3]);
+    __m256 s5 = Sub2x2(a[2], a[7], a[6], a[3]);
+    __m256 c5 = Sub2x2(a[10], a[15], a[14], a[11]);
+    __m256 c4 = Sub2x2(a[9], a[15], a[13], a[11]);
+    __m256 c3 = Sub2x2(a[9], a[14], a[13], a[10]);
+    __m256 c2 = Sub2x2(a[8], a[15], a[12], a[11]);
+    __m256 c1 = Sub2x2(a[8], a[14], a[12], a[10]);
+    __m256 c0 = Sub2x2(a[8], a[13], a[12], a[9]);
+
+    __m256 det = _mm256_add_ps(_mm256_sub_ps(_mm256_mul_ps(s0, c5), _mm256_mul_ps(s1, c4)), _mm256_mul_ps(s2, c3));
+    det = _mm256_add_ps(det, _mm256_sub_ps(_mm256_mul_ps(s3, c2), _mm256_mul_ps(s4, c1)));
+    det = _mm256_add_ps(det, _mm256_mul_ps(s5, c0));
+
+    const __m256 absMask = _mm256_castsi256_ps(_mm256_set1_epi32(0x7FFFFFFF));
+    __m256 singular = _mm256_cmp_ps(_mm256_and_ps(det, absMask), _mm256_set1_ps(MathUtils::EPSILON), _CMP_NGT_UQ);
+    int singularMask = _mm256_movemask_ps(singular);
+    __m256 invDet = _mm256_div_ps(_mm256_set1_ps(1.0f), det);
+    __m256 negInvDet = _mm256_sub_ps(_mm256_setzero_ps(), invDet);
+
+    __m256 b[16];
+    b[0] = _mm256_mul_ps(Cofactor3(a[5], c5, a[6], c4, a[7], c3), invDet);
+    b[1] = _mm256_mul_ps(Cofactor3(a[1], c5, a[2], c4, a[3], c3), negInvDet);
+    b[2] = _mm256_mul_ps(Cofactor3(a[13], s5, a[14], s4, a[15], s3), invDet);
+    b[3] = _mm256_mul_ps(Cofactor3(a[9], s5, a[10], s4, a[11], s3), negInvDet);
+    b[4] = _mm256_mul_ps(Cofactor3(a[4], c5, a[6], c2, a[7], c1), negInvDet);
+    b[5] = _mm256_mul_ps(Cofactor3(a[0], c5, a[2], c2, a[3], c1), invDet);
+    b[6] = _mm256_mul_ps(Cofactor3(a[12], s5, a[14], s2, a[15], s1), negInvDet);
+    b[7] = _mm256_mul_ps(Cofactor3(a[8], s5, a[10], s2, a[11], s1), invDet);
+    b[8] = _mm256_mul_ps(Cofactor3(a[4], c4, a[5], c2, a[7], c0), invDet);
+    b[9] = _mm256_mul_ps(Cofactor3(a[0], c4, a[1], c2, a[3], c0), negInvDet);
+    b[10] = _mm256_mul_ps(Cofactor3(a[12], s4, a[13], s2, a[15], s0), invDet);
+    b[11] = _mm256_mul_ps(Cofactor3(a[8], s4, a[9], s2, a[11], s0), negInvDet);
+    b[12] = _mm256_mul_ps(Cofactor3(a[4], c3, a[5], c1, a[6], c0), negInvDet);
+    b[13] = _mm256_mul_ps(Cofactor3(a[0], c3, a[1], c1, a[2], c0), invDet);
+    b[14] = _mm256_mul_ps(Cofactor3(a[12], s3, a[13], s1, a[14], s0), negInvDet);
+    b[15] = _mm256_mul_ps(Cofactor3(a[8], s3, a[9], s1, a[10], s0), invDet);
+
+    for (int col = 0; col < 4; ++col) {
+        Transpose4x4AVX(b[col * 4], b[col * 4 + 1], b[col * 4 + 2], b[col * 4 + 3]);
+        for (int j = 0; j < 4; ++j) {
+            if (!(singularMask & (1 << j))) {
+                _mm_storeu_ps(out + j * 16 + col * 4, _mm256_castps256_ps128(b[col * 4 + j]));
+            }
+            if (!(singularMask & (1 << (j + 4)))) {
+                _mm_storeu_ps(out + (j + 4) * 16 + col * 4, _mm256_extractf128_ps(b[col * 4 + j], 1));
+            }
+        }
+    }
+    return singularMask;
+}
+
+#endif
+
+Matrix4Kernels SelectKernels() {
+    Matrix4Kernels kernels = GetScalarMatrix4Kernels();
+#if defined(TERM3D_X86_SIMD)
+    SIMDLevel level = SIMD::GetLevel();
+    if (level >= SIMDLevel::SSE2) {
+        kernels.multiply = MultiplySSE;
+        kernels.invert = InvertSSE;
+        kernels.invertAffine = InvertAffineSSE;
+        kernels.transformPoints = TransformBatchSSE<BatchMode::Point>;
+        kernels.transformDirections = TransformBatchSSE<BatchMode::Direction>;
+        kernels.transformProjective = TransformBatchSSE<BatchMode::Projective>;
+        kernels.level = SIMDLevel::SSE2;
+    }
+    if (level >= SIMDLevel::AVX) {
+        kernels.multiply = MultiplyAVX;
+        kernels.transformPoints = TransformBatchAVX<BatchMode::Point>;
+        kernels.transformDirections = TransformBatchAVX<BatchMode::Direction>;
+        kernels.transformProjective = TransformBatchAVX<BatchMode::Projective>;
+        kernels.invertBatch8 = InvertBatch8AVX;
+        kernels.level = SIMDLevel::AVX;
+    }
+#endif
+    return kernels;
+}
+
+}
+
+const Matrix4Kernels& GetScalarMatrix4Kernels() {
+    static const Matrix4Kernels kernels = {
+        MultiplyScalar, InvertScalar, InvertAffineScalar,
+        TransformBatchScalar<BatchMode::Point>,
+        TransformBatchScalar<BatchMode::Direction>,
+        TransformBatchScalar<BatchMode::Projective>,
+        nullptr,
+        SIMDLevel::Scalar
+    };
+    return kernels;
+}
+
+const Matrix4Kernels& GetMatrix4Kernels() {
+    static const Matrix4Kernels kernels = SelectKernels();
+    return kernels;
+}
+
+}
+}
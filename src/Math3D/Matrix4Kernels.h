@@ -0,0 +1,24 @@
+#pragma once
+
+#include "Math3D/SIMD.h"
+#include <cstddef>
+
+namespace Math3D {
+namespace Detail {
+
+struct Matrix4Kernels {
+    void (*multiply)(const float* a, const float* b, float* out);
+    bool (*invert)(const float* matrix, float* out);
+    bool (*invertAffine)(const float* matrix, float* out);
+    void (*transformPoints)(const float* matrix, const float* in, float* out, size_t count);
+    void (*transformDirections)(const float* matrix, const float* in, float* out, size_t count);
+    void (*transformProjective)(const float* matrix, const float* in, float* out, size_t count);
+    int (*invertBatch8)(const float* in, float* out);
+    SIMDLevel level;
+};
+
+const Matrix4Kernels& GetMatrix4Kernels();
+const Matrix4Kernels& GetScalarMatrix4Kernels();
+
+}
+}
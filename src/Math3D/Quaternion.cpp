@@ -0,0 +1,322 @@
+#include "Math3D/Quaternion.h"
+#include "Math3D/SIMD.h"
+
+#if defined(TERM3D_X86_SIMD)
+#include <immintrin.h>
+#endif
+
+namespace Math3D {
+
+namespace {
+
+constexpr float SLERP_LINEAR_THRESHOLD = 0.9995f;
+
+constexpr float ACOS_COEFFICIENTS[8] = {
+    1.5707963050f, -0.2145988016f, 0.0889789874f, -0.0501743046f,
+    0.0308918810f, -0.0170881256f, 0.0066700901f, -0.0012624911f
+};
+
+constexpr float SIN_COEFFICIENTS[6] = {
+    1.0f, -1.0f / 6.0f, 1.0f / 120.0f, -1.0f / 5040.0f, 1.0f / 362880.0f, -1.0f / 39916800.0f
+};
+
+struct QuaternionKernels {
+    void (*nlerp)(const Quaternion* from, const Quaternion* to, const float* t, Quaternion* out, size_t count);
+    void (*slerp)(const Quaternion* from, const Quaternion* to, const float* t, Quaternion* out, size_t count);
+};
+
+float AcosPolynomial(float x) {
+    float p = ACOS_COEFFICIENTS[7];
+    for (int i = 6; i >= 0; --i) {
+        p = p * x + ACOS_COEFFICIENTS[i];
+    }
+    return std::sqrt(1.0f - x) * p;
+}
+
+float SinPolynomial(float angle) {
+    float angle2 = angle * angle;
+    float p = SIN_COEFFICIENTS[5];
+    for (int i = 4; i >= 0; --i) {
+        p = p * angle2 + SIN_COEFFICIENTS[i];
+    }
+    return angle * p;
+}
+
+Quaternion Blend(const Quaternion& from, const Quaternion& to, float weightFrom, float weightTo) {
+    Quaternion result(from.x * weightFrom + to.x * weightTo,
+                      from.y * weightFrom + to.y * weightTo,
+                      from.z * weightFrom + to.z * weightTo,
+                      from.w * weightFrom + to.w * weightTo);
+    float invLength = 1.0f / std::sqrt(result.x * result.x + result.y * result.y + result.z * result.z + result.w * result.w);
+    return result * invLength;
+}
+
+Quaternion NlerpOne(const Quaternion& from, const Quaternion& to, float t) {
+    float cosAngle = from.Dot(to);
+    Quaternion target = cosAngle < 0.0f ? -to : to;
+    return Blend(from, target, 1.0f - t, t);
+}
+
+Quaternion SlerpOnePolynomial(const Quaternion& from, const Quaternion& to, float t) {
+    float cosAngle = from.Dot(to);
+    Quaternion target = to;
+    if (cosAngle < 0.0f) {
+        target = -to;
+        cosAngle = -cosAngle;
+    }
+
+    if (cosAngle > SLERP_LINEAR_THRESHOLD) {
+        return Blend(from, target, 1.0f - t, t);
+    }
+
+    float angle = AcosPolynomial(cosAngle);
+    float invSin = 1.0f / SinPolynomial(angle);
+    return Blend(from, target, SinPolynomial((1.0f - t) * angle) * invSin, SinPolynomial(t * angle) * invSin);
+}
+
+void NlerpScalar(const Quaternion* from, const Quaternion* to, const float* t, Quaternion* out, size_t count) {
+    for (size_t i = 0; i < count; ++i) {
+        out[i] = NlerpOne(from[i], to[i], t[i]);
+    }
+}
+
+void SlerpScalar(const Quaternion* from, const Quaternion* to, const float* t, Quaternion* out, size_t count) {
+    for (size_t i = 0; i < count; ++i) {
+        out[i] = SlerpOnePolynomial(from[i], to[i], t[i]);
+    }
+}
+
+#if defined(TERM3D_X86_SIMD)
+
+TERM3D_TARGET_SSE2 inline __m128 PolynomialSSE(__m128 x, const float* coefficients, int degree) {
+    __m128 p = _mm_set1_ps(coefficients[degree]);
+    for (int i = degree - 1; i >= 0; --i) {
+        p = _mm_add_ps(_mm_mul_ps(p, x), _mm_set1_ps(coefficients[i]));
+    }
+    return p;
+}
+
+TERM3D_TARGET_SSE2 inline __m128 SinSSE(__m128 angle) {
+    return _mm_mul_ps(angle, PolynomialSSE(_mm_mul_ps(angle, angle), SIN_COEFFICIENTS, 5));
+}
+
+template <bool Spherical>
+TERM3D_TARGET_SSE2 void InterpolateSSE(const Quaternion* from, const Quaternion* to, const float* t, Quaternion* out, size_t count) {
+    const __m128 one = _mm_set1_ps(1.0f);
+    const __m128 signMask = _mm_set1_ps(-0.0f);
+    const __m128 threshold = _mm_set1_ps(SLERP_LINEAR_THRESHOLD);
+
+    size_t i = 0;
+    for (; i + 4 <= count; i += 4) {
+        __m128 ax = _mm_loadu_ps(&from[i].x), ay = _mm_loadu_ps(&from[i + 1].x);
+        __m128 az = _mm_loadu_ps(&from[i + 2].x), aw = _mm_loadu_ps(&from[i + 3].x);
+        _MM_TRANSPOSE4_PS(ax, ay, az, aw);
+        __m128 bx = _mm_loadu_ps(&to[i].x), by = _mm_loadu_ps(&to[i + 1].x);
+        __m128 bz = _mm_loadu_ps(&to[i + 2].x), bw = _mm_loadu_ps(&to[i + 3].x);
+        _MM_TRANSPOSE4_PS(bx, by, bz, bw);
+        __m128 vt = _mm_loadu_ps(t + i);
+
+        __m128 cosAngle = _mm_add_ps(_mm_add_ps(_mm_add_ps(_mm_mul_ps(ax, bx), _mm_mul_ps(ay, by)),
+                                                _mm_mul_ps(az, bz)), _mm_mul_ps(aw, bw));
+        __m128 sign = _mm_and_ps(_mm_cmplt_ps(cosAngle, _mm_setzero_ps()), signMask);
+        bx = _mm_xor_ps(bx, sign);
+        by = _mm_xor_ps(by, sign);
+        bz = _mm_xor_ps(bz, sign);
+        bw = _mm_xor_ps(bw, sign);
+
+        __m128 weightFrom = _mm_sub_ps(one, vt);
+        __m128 weightTo = vt;
+        if (Spherical) {
+            cosAngle = _mm_xor_ps(cosAngle, sign);
+            __m128 linear = _mm_cmpgt_ps(cosAngle, threshold);
+            __m128 angle = _mm_mul_ps(_mm_sqrt_ps(_mm_sub_ps(one, _mm_min_ps(cosAngle, one))),
+                                      PolynomialSSE(cosAngle, ACOS_COEFFICIENTS, 7));
+            __m128 invSin = _mm_div_ps(one, SinSSE(angle));
+            __m128 sphericalFrom = _mm_mul_ps(SinSSE(_mm_mul_ps(weightFrom, angle)), invSin);
+            __m128 sphericalTo = _mm_mul_ps(SinSSE(_mm_mul_ps(vt, angle)), invSin);
+            weightFrom = _mm_or_ps(_mm_and_ps(linear, weightFrom), _mm_andnot_ps(linear, sphericalFrom));
+            weightTo = _mm_or_ps(_mm_and_ps(linear, weightTo), _mm_andnot_ps(linear, sphericalTo));
+        }
+
+        __m128 rx = _mm_add_ps(_mm_mul_ps(ax, weightFrom), _mm_mul_ps(bx, weightTo));
+        __m128 ry = _mm_add_ps(_mm_mul_ps(ay, weightFrom), _mm_mul_ps(by, weightTo));
+        __m128 rz = _mm_add_ps(_mm_mul_ps(az, weightFrom), _mm_mul_ps(bz, weightTo));
+        __m128 rw = _mm_add_ps(_mm_mul_ps(aw, weightFrom), _mm_mul_ps(bw, weightTo));
+        __m128 lengthSquared = _mm_add_ps(_mm_add_ps(_mm_add_ps(_mm_mul_ps(rx, rx), _mm_mul_ps(ry, ry)),
+                                                     _mm_mul_ps(rz, rz)), _mm_mul_ps(rw, rw));
+        __m128 invLength = _mm_div_ps(one, _mm_sqrt_ps(lengthSquared));
+        rx = _mm_mul_ps(rx, invLength);
+        ry = _mm_mul_ps(ry, invLength);
+        rz = _mm_mul_ps(rz, invLength);
+        rw = _mm_mul_ps(rw, invLength);
+
+        _MM_TRANSPOSE4_PS(rx, ry, rz, rw);
+        _mm_storeu_ps(&out[i].x, rx);
+        _mm_storeu_ps(&out[i + 1].x, ry);
+        _mm_storeu_ps(&out[i + 2].x, rz);
+        _mm_storeu_ps(&out[i + 3].x, rw);
+    }
+
+    if (Spherical) {
+        SlerpScalar(from + i, to + i, t + i, out + i, count - i);
+    } else {
+        NlerpScalar(from + i, to + i, t + i, out + i, count - i);
+    }
+}
+
+TERM3D_TARGET_AVX inline void Transpose4x4AVX(__m256& r0, __m256& r1, __m256& r2, __m256& r3) {
+    __m256 t0 = _mm256_unpacklo_ps(r0, r1);
+    __m256 t1 = _mm256_unpackhi_ps(r0, r1);
+    __m256 t2 = _mm256_unpacklo_ps(r2, r3);
+    __m256 t3 = _mm256_unpackhi_ps(r2, r3);
+    r0 = _mm256_shuffle_ps(t0, t2, _MM_SHUFFLE(1, 0, 1, 0));
+    r1 = _mm256_shuffle_ps(t0, t2, _MM_SHUFFLE(3, 2, 3, 2));
+    r2 = _mm256_shuffle_ps(t1, t3, _MM_SHUFFLE(1, 0, 1, 0));
+    r3 = _mm256_shuffle_ps(t1, t3, _MM_SHUFFLE(3, 2, 3, 2));
+}
+
+TERM3D_TARGET_AVX inline void LoadSoAAVX(const Quaternion* q, __m256& x, __m256& y, __m256& z, __m256& w) {
+    x = _mm256_insertf128_ps(_mm256_castps128_ps256(_mm_loadu_ps(&q[0].x)), _mm_loadu_ps(&q[4].x), 1);
+    y = _mm256_insertf128_ps(_mm256_castps128_ps256(_mm_loadu_ps(&q[1].x)), _mm_loadu_ps(&q[5].x), 1);
+    z = _mm256_insertf128_ps(_mm256_castps128_ps256(_mm_loadu_ps(&q[2].x)), _mm_loadu_ps(&q[6].x), 1);
+    w = _mm256_insertf128_ps(_mm256_castps128_ps256(_mm_loadu_ps(&q[3].x)), _mm_loadu_ps(&q[7].x), 1);
+    Transpose4x4AVX(x, y, z, w);
+}
+
+TERM3D_TARGET_AVX inline void StoreSoAAVX(Quaternion* q, __m256 x, __m256 y, __m256 z, __m256 w) {
+    Transpose4x4AVX(x, y, z, w);
+    _mm_storeu_ps(&q[0].x, _mm256_castps256_ps128(x));
+    _mm_storeu_ps(&q[1].x, _mm256_castps256_ps128(y));
+    _mm_storeu_ps(&q[2].x, _mm256_castps256_ps128(z));
+    _mm_storeu_ps(&q[3].x, _mm256_castps256_ps128(w));
+    _mm_storeu_ps(&q[4].x, _mm256_extractf128_ps(x, 1));
+    _mm_storeu_ps(&q[5].x, _mm256_extractf128_ps(y, 1));
+    _mm_storeu_ps(&q[6].x, _mm256_extractf128_ps(z, 1));
+    _mm_storeu_ps(&q[7].x, _mm256_extractf128_ps(w, 1));
+}
+
+TERM3D_TARGET_AVX inline __m256 PolynomialAVX(__m256 x, const float* coefficients, int degree) {
+    __m256 p = _mm256_set1_ps(coefficients[degree]);
+    for (int i = degree - 1; i >= 0; --i) {
+        p = _mm256_add_ps(_mm256_mul_ps(p, x), _mm256_set1_ps(coefficients[i]));
+    }
+    return p;
+}
+
+TERM3D_TARGET_AVX inline __m256 SinAVX(__m256 angle) {
+    return _mm256_mul_ps(angle, PolynomialAVX(_mm256_mul_ps(angle, angle), SIN_COEFFICIENTS, 5));
+}
+
+template <bool Spherical>
+TERM3D_TARGET_AVX void InterpolateAVX(const Quaternion* from, const Quaternion* to, const float* t, Quaternion* out, size_t count) {
+    const __m256 one = _mm256_set1_ps(1.0f);
+    const __m256 signMask = _mm256_set1_ps(-0.0f);
+    const __m256 threshold = _mm256_set1_ps(SLERP_LINEAR_THRESHOLD);
+
+    size_t i = 0;
+    for (; i + 8 <= count; i += 8) {
+        __m256 ax, ay, az, aw, bx, by, bz, bw;
+        LoadSoAAVX(from + i, ax, ay, az, aw);
+        LoadSoAAVX(to + i, bx, by, bz, bw);
+        __m256 vt = _mm256_loadu_ps(t + i);
+
+        __m256 cosAngle = _mm256_add_ps(_mm256_add_ps(_mm256_add_ps(_mm256_mul_ps(ax, bx), _mm256_mul_ps(ay, by)),
+                                                      _mm256_mul_ps(az, bz)), _mm256_mul_ps(aw, bw));
+        __m256 sign = _mm256_and_ps(_mm256_cmp_ps(cosAngle, _mm256_setzero_ps(), _CMP_LT_OQ), signMask);
+        bx = _mm256_xor_ps(bx, sign);
+        by = _mm256_xor_ps(by, sign);
+        bz = _mm256_xor_ps(bz, sign);
+        bw = _mm256_xor_ps(bw, sign);
+
+        __m256 weightFrom = _mm256_sub_ps(one, vt);
+        __m256 weightTo = vt;
+        if (Spherical) {
+            cosAngle = _mm256_xor_ps(cosAngle, sign);
+            __m256 linear = _mm256_cmp_ps(cosAngle, threshold, _CMP_GT_OQ);
+            __m256 angle = _mm256_mul_ps(_mm256_sqrt_ps(_mm256_sub_ps(one, _mm256_min_ps(cosAngle, one))),
+                                         PolynomialAVX(cosAngle, ACOS_COEFFICIENTS, 7));
+            __m256 invSin = _mm256_div_ps(one, SinAVX(angle));
+            __m256 sphericalFrom = _mm256_mul_ps(SinAVX(_mm256_mul_ps(weightFrom, angle)), invSin);
+            __m256 sphericalTo = _mm256_mul_ps(SinAVX(_mm256_mul_ps(vt, angle)), invSin);
+            weightFrom = _mm256_blendv_ps(sphericalFrom, weightFrom, linear);
+            weightTo = _mm256_blendv_ps(sphericalTo, weightTo, linear);
+        }
+
+        __m256 rx = _mm256_add_ps(_mm256_mul_ps(ax, weightFrom), _mm256_mul_ps(bx, weightTo));
+        __m256 ry = _mm256_add_ps(_mm256_mul_ps(ay, weightFrom), _mm256_mul_ps(by, weightTo));
+        __m256 rz = _mm256_add_ps(_mm256_mul_ps(az, weightFrom), _mm256_mul_ps(bz, weightTo));
+        __m256 rw = _mm256_add_ps(_mm256_mul_ps(aw, weightFrom), _mm256_mul_ps(bw, weightTo));
+        __m256 lengthSquared = _mm256_add_ps(_mm256_add_ps(_mm256_add_ps(_mm256_mul_ps(rx, rx), _mm256_mul_ps(ry, ry)),
+                                                           _mm256_mul_ps(rz, rz)), _mm256_mul_ps(rw, rw));
+        __m256 invLength = _mm256_div_ps(one, _mm256_sqrt_ps(lengthSquared));
+
+        StoreSoAAVX(out + i, _mm256_mul_ps(rx, invLength), _mm256_mul_ps(ry, invLength),
+                    _mm256_mul_ps(rz, invLength), _mm256_mul_ps(rw, invLength));
+    }
+
+    InterpolateSSE<Spherical>(from + i, to + i, t + i, out + i, count - i);
+}
+
+#endif
+
+QuaternionKernels SelectKernels() {
+    QuaternionKernels kernels = { NlerpScalar, SlerpScalar };
+#if defined(TERM3D_X86_SIMD)
+    SIMDLevel level = SIMD::GetLevel();
+    if (level >= SIMDLevel::AVX) {
+        kernels = { InterpolateAVX<false>, InterpolateAVX<true> };
+    } else if (level >= SIMDLevel::SSE2) {
+        kernels = { InterpolateSSE<false>, InterpolateSSE<true> };
+    }
+#endif
+    return kernels;
+}
+
+const QuaternionKernels& GetKernels() {
+    static const QuaternionKernels kernels = SelectKernels();
+    return kernels;
+}
+
+}
+
+Quaternion Quaternion::FromAxisAngle(const Vector3& axis, float angle) {
+    Vector3 unitAxis = axis.Normalized();
+    float s, c;
+    MathUtils::SinCos(angle * 0.5f, s, c);
+    return Quaternion(unitAxis.x * s, unitAxis.y * s, unitAxis.z * s, c);
+}
+
+Quaternion Quaternion::FromEuler(float pitch, float yaw, float roll) {
+    return FromAxisAngle(Vector3::UnitY, yaw) * FromAxisAngle(Vector3::UnitX, pitch) * FromAxisAngle(Vector3::UnitZ, roll);
+}
+
+Quaternion Quaternion::Nlerp(const Quaternion& from, const Quaternion& to, float t) {
+    return NlerpOne(from, to, t);
+}
+
+Quaternion Quaternion::Slerp(const Quaternion& from, const Quaternion& to, float t) {
+    float cosAngle = from.Dot(to);
+    Quaternion target = to;
+    if (cosAngle < 0.0f) {
+        target = -to;
+        cosAngle = -cosAngle;
+    }
+
+    if (cosAngle > SLERP_LINEAR_THRESHOLD) {
+        return Blend(from, target, 1.0f - t, t);
+    }
+
+    float angle = std::acos(cosAngle);
+    float invSin = 1.0f / std::sin(angle);
+    return Blend(from, target, std::sin((1.0f - t) * angle) * invSin, std::sin(t * angle) * invSin);
+}
+
+void Quaternion::NlerpBatch(const Quaternion* from, const Quaternion* to, const float* t, Quaternion* out, size_t count) {
+    GetKernels().nlerp(from, to, t, out, count);
+}
+
+void Quaternion::SlerpBatch(const Quaternion* from, const Quaternion* to, const float* t, Quaternion* out, size_t count) {
+    GetKernels().slerp(from, to, t, out, count);
+}
+
+}
@@ -0,0 +1,94 @@
+#include "Math3D/SIMD.h"
+
+#if defined(TERM3D_X86_SIMD)
+#if defined(_MSC_VER)
+#include <intrin.h>
+#else
+#include <cpuid.h>
+#endif
+#endif
+
+namespace Math3D {
+
+namespace {
+
+#if defined(TERM3D_X86_SIMD)
+void QueryCPUID(unsigned leaf, unsigned subleaf, unsigned registers[4]) {
+#if defined(_MSC_VER)
+    int values[4];
+    __cpuidex(values, static_cast<int>(leaf), static_cast<int>(subleaf));
+    for (int i = 0; i < 4; ++i) {
+        registers[i] = static_cast<unsigned>(values[i]);
+    }
+#else
+    registers[0] = registers[1] = registers[2] = registers[3] = 0;
+    __cpuid_count(leaf, subleaf, registers[0], registers[1], registers[2], registers[3]);
+#endif
+}
+
+unsigned long long ReadXCR0() {
+#if defined(_MSC_VER)
+    return _xgetbv(0);
+#else
+    unsigned low, high;
+    __asm__ volatile("xgetbv" : "=a"(low), "=d"(high) : "c"(0));
+    return (static_cast<unsigned long long>(high) << 32) | low;
+#endif
+}
+
+SIMDLevel DetectLevel() {
+    unsigned registers[4];
+    QueryCPUID(0, 0, registers);
+    unsigned maxLeaf = registers[0];
+    if (maxLeaf < 1) {
+        return SIMDLevel::Scalar;
+    }
+
+    QueryCPUID(1, 0, registers);
+    const unsigned ecx = registers[2];
+    const unsigned edx = registers[3];
+
+    if (!(edx & (1u << 26))) {
+        return SIMDLevel::Scalar;
+    }
+    if (!(ecx & (1u << 19))) {
+        return SIMDLevel::SSE2;
+    }
+
+    const bool osSavesYmm = (ecx & (1u << 27)) && (ReadXCR0() & 0x6) == 0x6;
+    if (!(ecx & (1u << 28)) || !osSavesYmm) {
+        return SIMDLevel::SSE41;
+    }
+
+    if (maxLeaf >= 7) {
+        QueryCPUID(7, 0, registers);
+        if (registers[1] & (1u << 5)) {
+            return SIMDLevel::AVX2;
+        }
+    }
+    return SIMDLevel::AVX;
+}
+#else
+SIMDLevel DetectLevel() {
+    return SIMDLevel::Scalar;
+}
+#endif
+
+}
+
+SIMDLevel SIMD::GetLevel() {
+    static const SIMDLevel level = DetectLevel();
+    return level;
+}
+
+const char* SIMD::GetLevelName(SIMDLevel level) {
+    switch (level) {
+        case SIMDLevel::SSE2: return "SSE2";
+        case SIMDLevel::SSE41: return "SSE4.1";
+        case SIMDLevel::AVX: return "AVX";
+        case SIMDLevel::AVX2: return "AVX2";
+        default: return "Scalar";
+    }
+}
+
+}
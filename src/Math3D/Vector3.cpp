@@ -1,112 +0,0 @@
-#include "Math3D/Vector3.h"
-#include <cmath>
-
-namespace Math3D {
-
-Vector3::Vector3() : x(0.0f), y(0.0f), z(0.0f) {}
-Vector3::Vector3(float x, float y, float z) : x(x), y(y), z(z) {}
-
-Vector3 Vector3::operator+(const Vector3& other) const {
-    return Vector3(x + other.x, y + other.y, z + other.z);
-}
-
-Vector3 Vector3::operator-(const Vector3& other) const {
-    return Vector3(x - other.x, y - other.y, z - other.z);
-}
-
-Vector3 Vector3::operator-() const {
-    return Vector3(-x, -y, -z);
-}
-
-Vector3 Vector3::operator*(float scalar) const {
-    return Vector3(x * scalar, y * scalar, z * scalar);
-}
-
-Vector3 Vector3::operator/(float scalar) const {
-    float invScalar = 1.0f / scalar;
-    return Vector3(x * invScalar, y * invScalar, z * invScalar);
-}
-
-Vector3& Vector3::operator+=(const Vector3& other) {
-    x += other.x;
-    y += other.y;
-    z += other.z;
-    return *this;
-}
-
-Vector3& Vector3::operator-=(const Vector3& other) {
-    x -= other.x;
-    y -= other.y;
-    z -= other.z;
-    return *this;
-}
-
-Vector3& Vector3::operator*=(float scalar) {
-    x *= scalar;
-    y *= scalar;
-    z *= scalar;
-    return *this;
-}
-
-Vector3& Vector3::operator/=(float scalar) {
-    float invScalar = 1.0f / scalar;
-    x *= invScalar;
-    y *= invScalar;
-    z *= invScalar;
-    return *this;
-}
-
-bool Vector3::operator==(const Vector3& other) const {
-    return x == other.x && y == other.y && z == other.z;
-}
-
-bool Vector3::operator!=(const Vector3& other) const {
-    return !(*this == other);
-}
-
-float Vector3::Dot(const Vector3& other) const {
-    return x * other.x + y * other.y + z * other.z;
-}
-
-Vector3 Vector3::Cross(const Vector3& other) const {
-    return Vector3(
-        y * other.z - z * other.y,
-        z * other.x - x * other.z,
-        x * other.y - y * other.x
-    );
-}
-
-float Vector3::Length() const {
-    return std::sqrt(LengthSquared());
-}
-
-float Vector3::LengthSquared() const {
-    return x * x + y * y + z * z;
-}
-
-Vector3 Vector3::Normalized() const {
-    float len = Length();
-    if (len > 0.0f) {
-        return *this / len;
-    }
-    return Zero;
-}
-
-void Vector3::Normalize() {
-    float len = Length();
-    if (len > 0.0f) {
-        *this /= len;
-    }
-}
-
-const Vector3 Vector3::Zero(0.0f, 0.0f, 0.0f);
-const Vector3 Vector3::One(1.0f, 1.0f, 1.0f);
-const Vector3 Vector3::UnitX(1.0f, 0.0f, 0.0f);
-const Vector3 Vector3::UnitY(0.0f, 1.0f, 0.0f);
-const Vector3 Vector3::UnitZ(0.0f, 0.0f, 1.0f);
-
-Vector3 operator*(float scalar, const Vector3& vector) {
-    return vector * scalar;
-}
-
-} 
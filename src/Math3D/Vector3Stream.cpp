@@ -0,0 +1,499 @@
+#include "Math3D/Vector3Stream.h"
+#include "Math3D/Matrix3.h"
+#include "Math3D/Matrix4.h"
+#include "Math3D/SIMD.h"
+#include <algorithm>
+#include <cmath>
+
+#if defined(TERM3D_X86_SIMD)
+#include <immintrin.h>
+#endif
+
+namespace Math3D {
+
+namespace {
+
+struct StreamKernels {
+    void (*add)(const float* a, const float* b, float* out, size_t count);
+    void (*subtract)(const float* a, const float* b, float* out, size_t count);
+    void (*scale)(const float* a, float scalar, float* out, size_t count);
+    void (*dot)(const float* ax, const float* ay, const float* az,
+                const float* bx, const float* by, const float* bz, float* out, size_t count);
+    void (*cross)(const float* ax, const float* ay, const float* az,
+                  const float* bx, const float* by, const float* bz,
+                  float* ox, float* oy, float* oz, size_t count);
+    void (*length)(const float* x, const float* y, const float* z, float* out, size_t count);
+    void (*normalize)(float* x, float* y, float* z, size_t count);
+    void (*minMax)(const float* values, size_t count, float& min, float& max);
+    void (*transform)(float* x, float* y, float* z, size_t count, const float* matrix);
+};
+
+void AddScalar(const float* a, const float* b, float* out, size_t count) {
+    for (size_t i = 0; i < count; ++i) {
+        out[i] = a[i] + b[i];
+    }
+}
+
+void SubtractScalar(const float* a, const float* b, float* out, size_t count) {
+    for (size_t i = 0; i < count; ++i) {
+        out[i] = a[i] - b[i];
+    }
+}
+
+void ScaleScalar(const float* a, float scalar, float* out, size_t count) {
+    for (size_t i = 0; i < count; ++i) {
+        out[i] = a[i] * scalar;
+    }
+}
+
+void DotScalar(const float* ax, const float* ay, const float* az,
+               const float* bx, const float* by, const float* bz, float* out, size_t count) {
+    for (size_t i = 0; i < count; ++i) {
+        out[i] = ax[i] * bx[i] + ay[i] * by[i] + az[i] * bz[i];
+    }
+}
+
+void CrossScalar(const float* ax, const float* ay, const float* az,
+                 const float* bx, const float* by, const float* bz,
+                 float* ox, float* oy, float* oz, size_t count) {
+    for (size_t i = 0; i < count; ++i) {
+        float x = ay[i] * bz[i] - az[i] * by[i];
+        float y = az[i] * bx[i] - ax[i] * bz[i];
+        float z = ax[i] * by[i] - ay[i] * bx[i];
+        ox[i] = x;
+        oy[i] = y;
+        oz[i] = z;
+    }
+}
+
+void LengthScalar(const float* x, const float* y, const float* z, float* out, size_t count) {
+    for (size_t i = 0; i < count; ++i) {
+        out[i] = std::sqrt(x[i] * x[i] + y[i] * y[i] + z[i] * z[i]);
+    }
+}
+
+void NormalizeScalar(float* x, float* y, float* z, size_t count) {
+    for (size_t i = 0; i < count; ++i) {
+        float length = std::sqrt(x[i] * x[i] + y[i] * y[i] + z[i] * z[i]);
+        if (length > 0.0f) {
+            float invLength = 1.0f / length;
+            x[i] *= invLength;
+            y[i] *= invLength;
+            z[i] *= invLength;
+        }
+    }
+}
+
+void MinMaxScalar(const float* values, size_t count, float& min, float& max) {
+    for (size_t i = 0; i < count; ++i) {
+        min = std::min(min, values[i]);
+        max = std::max(max, values[i]);
+    }
+}
+
+void TransformScalar(float* x, float* y, float* z, size_t count, const float* matrix) {
+    for (size_t i = 0; i < count; ++i) {
+        float px = x[i], py = y[i], pz = z[i];
+        x[i] = matrix[0] * px + matrix[3] * py + matrix[6] * pz + matrix[9];
+        y[i] = matrix[1] * px + matrix[4] * py + matrix[7] * pz + matrix[10];
+        z[i] = matrix[2] * px + matrix[5] * py + matrix[8] * pz + matrix[11];
+    }
+}
+
+#if defined(TERM3D_X86_SIMD)
+
+TERM3D_TARGET_SSE2 void AddSSE(const float* a, const float* b, float* out, size_t count) {
+    size_t i = 0;
+    for (; i + 4 <= count; i += 4) {
+        _mm_storeu_ps(out + i, _mm_add_ps(_mm_loadu_ps(a + i), _mm_loadu_ps(b + i)));
+    }
+    AddScalar(a + i, b + i, out + i, count - i);
+}
+
+TERM3D_TARGET_SSE2 void SubtractSSE(const float* a, const float* b, float* out, size_t count) {
+    size_t i = 0;
+    for (; i + 4 <= count; i += 4) {
+        _mm_storeu_ps(out + i, _mm_sub_ps(_mm_loadu_ps(a + i), _mm_loadu_ps(b + i)));
+    }
+    SubtractScalar(a + i, b + i, out + i, count - i);
+}
+
+TERM3D_TARGET_SSE2 void ScaleSSE(const float* a, float scalar, float* out, size_t count) {
+    __m128 s = _mm_set1_ps(scalar);
+    size_t i = 0;
+    for (; i + 4 <= count; i += 4) {
+        _mm_storeu_ps(out + i, _mm_mul_ps(_mm_loadu_ps(a + i), s));
+    }
+    ScaleScalar(a + i, scalar, out + i, count - i);
+}
+
+TERM3D_TARGET_SSE2 void DotSSE(const float* ax, const float* ay, const float* az,
+                               const float* bx, const float* by, const float* bz, float* out, size_t count) {
+    size_t i = 0;
+    for (; i + 4 <= count; i += 4) {
+        __m128 sum = _mm_mul_ps(_mm_loadu_ps(ax + i), _mm_loadu_ps(bx + i));
+        sum = _mm_add_ps(sum, _mm_mul_ps(_mm_loadu_ps(ay + i), _mm_loadu_ps(by + i)));
+        sum = _mm_add_ps(sum, _mm_mul_ps(_mm_loadu_ps(az + i), _mm_loadu_ps(bz + i)));
+        _mm_storeu_ps(out + i, sum);
+    }
+    DotScalar(ax + i, ay + i, az + i, bx + i, by + i, bz + i, out + i, count - i);
+}
+
+TERM3D_TARGET_SSE2 void CrossSSE(const float* ax, const float* ay, const float* az,
+                                 const float* bx, const float* by, const float* bz,
+                                 float* ox, float* oy, float* oz, size_t count) {
+    size_t i = 0;
+    for (; i + 4 <= count; i += 4) {
+        __m128 x0 = _mm_loadu_ps(ax + i), y0 = _mm_loadu_ps(ay + i), z0 = _mm_loadu_ps(az + i);
+        __m128 x1 = _mm_loadu_ps(bx + i), y1 = _mm_loadu_ps(by + i), z1 = _mm_loadu_ps(bz + i);
+        _mm_storeu_ps(ox + i, _mm_sub_ps(_mm_mul_ps(y0, z1), _mm_mul_ps(z0, y1)));
+        _mm_storeu_ps(oy + i, _mm_sub_ps(_mm_mul_ps(z0, x1), _mm_mul_ps(x0, z1)));
+        _mm_storeu_ps(oz + i, _mm_sub_ps(_mm_mul_ps(x0, y1), _mm_mul_ps(y0, x1)));
+    }
+    CrossScalar(ax + i, ay + i, az + i, bx + i, by + i, bz + i, ox + i, oy + i, oz + i, count - i);
+}
+
+TERM3D_TARGET_SSE2 void LengthSSE(const float* x, const float* y, const float* z, float* out, size_t count) {
+    size_t i = 0;
+    for (; i + 4 <= count; i += 4) {
+        __m128 vx = _mm_loadu_ps(x + i), vy = _mm_loadu_ps(y + i), vz = _mm_loadu_ps(z + i);
+        __m128 sum = _mm_add_ps(_mm_add_ps(_mm_mul_ps(vx, vx), _mm_mul_ps(vy, vy)), _mm_mul_ps(vz, vz));
+        _mm_storeu_ps(out + i, _mm_sqrt_ps(sum));
+    }
+    LengthScalar(x + i, y + i, z + i, out + i, count - i);
+}
+
+TERM3D_TARGET_SSE2 void NormalizeSSE(float* x, float* y, float* z, size_t count) {
+    const __m128 zero = _mm_setzero_ps();
+    const __m128 one = _mm_set1_ps(1.0f);
+    size_t i = 0;
+    for (; i + 4 <= count; i += 4) {
+        __m128 vx = _mm_loadu_ps(x + i), vy = _mm_loadu_ps(y + i), vz = _mm_loadu_ps(z + i);
+        __m128 length = _mm_sqrt_ps(_mm_add_ps(_mm_add_ps(_mm_mul_ps(vx, vx), _mm_mul_ps(vy, vy)), _mm_mul_ps(vz, vz)));
+        __m128 valid = _mm_cmpgt_ps(length, zero);
+        __m128 scale = _mm_or_ps(_mm_and_ps(valid, _mm_div_ps(one, length)), _mm_andnot_ps(valid, one));
+        _mm_storeu_ps(x + i, _mm_mul_ps(vx, scale));
+        _mm_storeu_ps(y + i, _mm_mul_ps(vy, scale));
+        _mm_storeu_ps(z + i, _mm_mul_ps(vz, scale));
+    }
+    NormalizeScalar(x + i, y + i, z + i, count - i);
+}
+
+TERM3D_TARGET_SSE2 void MinMaxSSE(const float* values, size_t count, float& min, float& max) {
+    size_t i = 0;
+    if (count >= 4) {
+        __m128 vmin = _mm_set1_ps(min);
+        __m128 vmax = _mm_set1_ps(max);
+        for (; i + 4 <= count; i += 4) {
+            __m128 v = _mm_loadu_ps(values + i);
+            vmin = _mm_min_ps(vmin, v);
+            vmax = _mm_max_ps(vmax, v);
+        }
+        float lanes[4];
+        _mm_storeu_ps(lanes, vmin);
+        min = std::min(std::min(lanes[0], lanes[1]), std::min(lanes[2], lanes[3]));
+        _mm_storeu_ps(lanes, vmax);
+        max = std::max(std::max(lanes[0], lanes[1]), std::max(lanes[2], lanes[3]));
+    }
+    MinMaxScalar(values + i, count - i, min, max);
+}
+
+TERM3D_TARGET_SSE2 void TransformSSE(float* x, float* y, float* z, size_t count, const float* matrix) {
+    __m128 m[12];
+    for (int k = 0; k < 12; ++k) {
+        m[k] = _mm_set1_ps(matrix[k]);
+    }
+    size_t i = 0;
+    for (; i + 4 <= count; i += 4) {
+        __m128 px = _mm_loadu_ps(x + i), py = _mm_loadu_ps(y + i), pz = _mm_loadu_ps(z + i);
+        __m128 ox = _mm_add_ps(_mm_add_ps(_mm_add_ps(_mm_mul_ps(m[0], px), _mm_mul_ps(m[3], py)), _mm_mul_ps(m[6], pz)), m[9]);
+        __m128 oy = _mm_add_ps(_mm_add_ps(_mm_add_ps(_mm_mul_ps(m[1], px), _mm_mul_ps(m[4], py)), _mm_mul_ps(m[7], pz)), m[10]);
+        __m128 oz = _mm_add_ps(_mm_add_ps(_mm_add_ps(_mm_mul_ps(m[2], px), _mm_mul_ps(m[5], py)), _mm_mul_ps(m[8], pz)), m[11]);
+        _mm_storeu_ps(x + i, ox);
+        _mm_storeu_ps(y + i, oy);
+        _mm_storeu_ps(z + i, oz);
+    }
+    TransformScalar(x + i, y + i, z + i, count - i, matrix);
+}
+
+TERM3D_TARGET_AVX void AddAVX(const float* a, const float* b, float* out, size_t count) {
+    size_t i = 0;
+    for (; i + 8 <= count; i += 8) {
+        _mm256_storeu_ps(out + i, _mm256_add_ps(_mm256_loadu_ps(a + i), _mm256_loadu_ps(b + i)));
+    }
+    AddSSE(a + i, b + i, out + i, count - i);
+}
+
+TERM3D_TARGET_AVX void SubtractAVX(const float* a, const float* b, float* out, size_t count) {
+    size_t i = 0;
+    for (; i + 8 <= count; i += 8) {
+        _mm256_storeu_ps(out + i, _mm256_sub_ps(_mm256_loadu_ps(a + i), _mm256_loadu_ps(b + i)));
+    }
+    SubtractSSE(a + i, b + i, out + i, count - i);
+}
+
+TERM3D_TARGET_AVX void ScaleAVX(const float* a, float scalar, float* out, size_t count) {
+    __m256 s = _mm256_set1_ps(scalar);
+    size_t i = 0;
+    for (; i + 8 <= count; i += 8) {
+        _mm256_storeu_ps(out + i, _mm256_mul_ps(_mm256_loadu_ps(a + i), s));
+    }
+    ScaleSSE(a + i, scalar, out + i, count - i);
+}
+
+TERM3D_TARGET_AVX void DotAVX(const float* ax, const float* ay, const float* az,
+                              const float* bx, const float* by, const float* bz, float* out, size_t count) {
+    size_t i = 0;
+    for (; i + 8 <= count; i += 8) {
+        __m256 sum = _mm256_mul_ps(_mm256_loadu_ps(ax + i), _mm256_loadu_ps(bx + i));
+        sum = _mm256_add_ps(sum, _mm256_mul_ps(_mm256_loadu_ps(ay + i), _mm256_loadu_ps(by + i)));
+        sum = _mm256_add_ps(sum, _mm256_mul_ps(_mm256_loadu_ps(az + i), _mm256_loadu_ps(bz + i)));
+        _mm256_storeu_ps(out + i, sum);
+    }
+    DotSSE(ax + i, ay + i, az + i, bx + i, by + i, bz + i, out + i, count - i);
+}
+
+TERM3D_TARGET_AVX void CrossAVX(const float* ax, const float* ay, const float* az,
+                                const float* bx, const float* by, const float* bz,
+                                float* ox, float* oy, float* oz, size_t count) {
+    size_t i = 0;
+    for (; i + 8 <= count; i += 8) {
+        __m256 x0 = _mm256_loadu_ps(ax + i), y0 = _mm256_loadu_ps(ay + i), z0 = _mm256_loadu_ps(az + i);
+        __m256 x1 = _mm256_loadu_ps(bx + i), y1 = _mm256_loadu_ps(by + i), z1 = _mm256_loadu_ps(bz + i);
+        _mm256_storeu_ps(ox + i, _mm256_sub_ps(_mm256_mul_ps(y0, z1), _mm256_mul_ps(z0, y1)));
+        _mm256_storeu_ps(oy + i, _mm256_sub_ps(_mm256_mul_ps(z0, x1), _mm256_mul_ps(x0, z1)));
+        _mm256_storeu_ps(oz + i, _mm256_sub_ps(_mm256_mul_ps(x0, y1), _mm256_mul_ps(y0, x1)));
+    }
+    CrossSSE(ax + i, ay + i, az + i, bx + i, by + i, bz + i, ox + i, oy + i, oz + i, count - i);
+}
+
+TERM3D_TARGET_AVX void LengthAVX(const float* x, const float* y, const float* z, float* out, size_t count) {
+    size_t i = 0;
+    for (; i + 8 <= count; i += 8) {
+        __m256 vx = _mm256_loadu_ps(x + i), vy = _mm256_loadu_ps(y + i), vz = _mm256_loadu_ps(z + i);
+        __m256 sum = _mm256_add_ps(_mm256_add_ps(_mm256_mul_ps(vx, vx), _mm256_mul_ps(vy, vy)), _mm256_mul_ps(vz, vz));
+        _mm256_storeu_ps(out + i, _mm256_sqrt_ps(sum));
+    }
+    LengthSSE(x + i, y + i, z + i, out + i, count - i);
+}
+
+TERM3D_TARGET_AVX void NormalizeAVX(float* x, float* y, float* z, size_t count) {
+    const __m256 zero = _mm256_setzero_ps();
+    const __m256 one = _mm256_set1_ps(1.0f);
+    size_t i = 0;
+    for (; i + 8 <= count; i += 8) {
+        __m256 vx = _mm256_loadu_ps(x + i), vy = _mm256_loadu_ps(y + i), vz = _mm256_loadu_ps(z + i);
+        __m256 length = _mm256_sqrt_ps(_mm256_add_ps(_mm256_add_ps(_mm256_mul_ps(vx, vx), _mm256_mul_ps(vy, vy)),
+                                                     _mm256_mul_ps(vz, vz)));
+        __m256 valid = _mm256_cmp_ps(length, zero, _CMP_GT_OQ);
+        __m256 scale = _mm256_blendv_ps(one, _mm256_div_ps(one, length), valid);
+        _mm256_storeu_ps(x + i, _mm256_mul_ps(vx, scale));
+        _mm256_storeu_ps(y + i, _mm256_mul_ps(vy, scale));
+        _mm256_storeu_ps(z + i, _mm256_mul_ps(vz, scale));
+    }
+    NormalizeSSE(x + i, y + i, z + i, count - i);
+}
+
+TERM3D_TARGET_AVX void MinMaxAVX(const float* values, size_t count, float& min, float& max) {
+    size_t i = 0;
+    if (count >= 8) {
+        __m256 vmin = _mm256_set1_ps(min);
+        __m256 vmax = _mm256_set1_ps(max);
+        for (; i + 8 <= count; i += 8) {
+            __m256 v = _mm256_loadu_ps(values + i);
+            vmin = _mm256_min_ps(vmin, v);
+            vmax = _mm256_max_ps(vmax, v);
+        }
+        __m128 lowMin = _mm_min_ps(_mm256_castps256_ps128(vmin), _mm256_extractf128_ps(vmin, 1));
+        __m128 lowMax = _mm_max_ps(_mm256_castps256_ps128(vmax), _mm256_extractf128_ps(vmax, 1));
+        float lanes[4];
+        _mm_storeu_ps(lanes, lowMin);
+        min = std::min(std::min(lanes[0], lanes[1]), std::min(lanes[2], lanes[3]));
+        _mm_storeu_ps(lanes, lowMax);
+        max = std::max(std::max(lanes[0], lanes[1]), std::max(lanes[2], lanes[3]));
+    }
+    MinMaxSSE(values + i, count - i, min, max);
+}
+
+TERM3D_TARGET_AVX void TransformAVX(float* x, float* y, float* z, size_t count, const float* matrix) {
+    __m256 m[12];
+    for (int k = 0; k < 12; ++k) {
+        m[k] = _mm256_set1_ps(matrix[k]);
+    }
+    size_t i = 0;
+    for (; i + 8 <= count; i += 8) {
+        __m256 px = _mm256_loadu_ps(x + i), py = _mm256_loadu_ps(y + i), pz = _mm256_loadu_ps(z + i);
+        __m256 ox = _mm256_add_ps(_mm256_add_ps(_mm256_add_ps(_mm256_mul_ps(m[0], px), _mm256_mul_ps(m[3], py)),
+                                                _mm256_mul_ps(m[6], pz)), m[9]);
+        __m256 oy = _mm256_add_ps(_mm256_add_ps(_mm256_add_ps(_mm256_mul_ps(m[1], px), _mm256_mul_ps(m[4], py)),
+                                                _mm256_mul_ps(m[7], pz)), m[10]);
+        __m256 oz = _mm256_add_ps(_mm256_add_ps(_mm256_add_ps(_mm256_mul_ps(m[2], px), _mm256_mul_ps(m[5], py)),
+                                                _mm256_mul_ps(m[8], pz)), m[11]);
+        _mm256_storeu_ps(x + i, ox);
+        _mm256_storeu_ps(y + i, oy);
+        _mm256_storeu_ps(z + i, oz);
+    }
+    TransformSSE(x + i, y + i, z + i, count - i, matrix);
+}
+
+#endif
+
+StreamKernels SelectKernels() {
+    StreamKernels kernels = {
+        AddScalar, SubtractScalar, ScaleScalar, DotScalar, CrossScalar, LengthScalar, NormalizeScalar, MinMaxScalar,
+        TransformScalar
+    };
+#if defined(TERM3D_X86_SIMD)
+    SIMDLevel level = SIMD::GetLevel();
+    if (level >= SIMDLevel::AVX) {
+        kernels = { AddAVX, SubtractAVX, ScaleAVX, DotAVX, CrossAVX, LengthAVX, NormalizeAVX, MinMaxAVX,
+                    TransformAVX };
+    } else if (level >= SIMDLevel::SSE2) {
+        kernels = { AddSSE, SubtractSSE, ScaleSSE, DotSSE, CrossSSE, LengthSSE, NormalizeSSE, MinMaxSSE,
+                    TransformSSE };
+    }
+#endif
+    return kernels;
+}
+
+const StreamKernels& GetKernels() {
+    static const StreamKernels kernels = SelectKernels();
+    return kernels;
+}
+
+}
+
+Vector3Stream::Vector3Stream(size_t count)
+    : m_x(count, 0.0f), m_y(count, 0.0f), m_z(count, 0.0f) {}
+
+Vector3Stream::Vector3Stream(const Vector3* data, size_t count) {
+    Assign(data, count);
+}
+
+void Vector3Stream::Resize(size_t count) {
+    m_x.resize(count, 0.0f);
+    m_y.resize(count, 0.0f);
+    m_z.resize(count, 0.0f);
+}
+
+void Vector3Stream::Reserve(size_t count) {
+    m_x.reserve(count);
+    m_y.reserve(count);
+    m_z.reserve(count);
+}
+
+void Vector3Stream::Clear() {
+    m_x.clear();
+    m_y.clear();
+    m_z.clear();
+}
+
+void Vector3Stream::PushBack(const Vector3& value) {
+    m_x.push_back(value.x);
+    m_y.push_back(value.y);
+    m_z.push_back(value.z);
+}
+
+void Vector3Stream::Set(size_t index, const Vector3& value) {
+    m_x[index] = value.x;
+    m_y[index] = value.y;
+    m_z[index] = value.z;
+}
+
+void Vector3Stream::Assign(const Vector3* data, size_t count) {
+    Resize(count);
+    for (size_t i = 0; i < count; ++i) {
+        m_x[i] = data[i].x;
+        m_y[i] = data[i].y;
+        m_z[i] = data[i].z;
+    }
+}
+
+void Vector3Stream::CopyTo(Vector3* out) const {
+    for (size_t i = 0; i < m_x.size(); ++i) {
+        out[i] = Vector3(m_x[i], m_y[i], m_z[i]);
+    }
+}
+
+void Vector3Stream::Add(const Vector3Stream& a, const Vector3Stream& b, Vector3Stream& out) {
+    size_t count = std::min(a.Size(), b.Size());
+    out.Resize(count);
+    const StreamKernels& kernels = GetKernels();
+    kernels.add(a.X(), b.X(), out.X(), count);
+    kernels.add(a.Y(), b.Y(), out.Y(), count);
+    kernels.add(a.Z(), b.Z(), out.Z(), count);
+}
+
+void Vector3Stream::Subtract(const Vector3Stream& a, const Vector3Stream& b, Vector3Stream& out) {
+    size_t count = std::min(a.Size(), b.Size());
+    out.Resize(count);
+    const StreamKernels& kernels = GetKernels();
+    kernels.subtract(a.X(), b.X(), out.X(), count);
+    kernels.subtract(a.Y(), b.Y(), out.Y(), count);
+    kernels.subtract(a.Z(), b.Z(), out.Z(), count);
+}
+
+void Vector3Stream::Scale(const Vector3Stream& a, float scalar, Vector3Stream& out) {
+    size_t count = a.Size();
+    out.Resize(count);
+    const StreamKernels& kernels = GetKernels();
+    kernels.scale(a.X(), scalar, out.X(), count);
+    kernels.scale(a.Y(), scalar, out.Y(), count);
+    kernels.scale(a.Z(), scalar, out.Z(), count);
+}
+
+void Vector3Stream::Dot(const Vector3Stream& a, const Vector3Stream& b, float* out) {
+    size_t count = std::min(a.Size(), b.Size());
+    GetKernels().dot(a.X(), a.Y(), a.Z(), b.X(), b.Y(), b.Z(), out, count);
+}
+
+void Vector3Stream::Cross(const Vector3Stream& a, const Vector3Stream& b, Vector3Stream& out) {
+    size_t count = std::min(a.Size(), b.Size());
+    out.Resize(count);
+    GetKernels().cross(a.X(), a.Y(), a.Z(), b.X(), b.Y(), b.Z(), out.X(), out.Y(), out.Z(), count);
+}
+
+void Vector3Stream::Lengths(float* out) const {
+    GetKernels().length(X(), Y(), Z(), out, Size());
+}
+
+void Vector3Stream::Normalize() {
+    GetKernels().normalize(X(), Y(), Z(), Size());
+}
+
+void Vector3Stream::TransformPoints(const Matrix4& matrix) {
+    float affine[12];
+    for (int col = 0; col < 4; ++col) {
+        for (int row = 0; row < 3; ++row) {
+            affine[col * 3 + row] = matrix(row, col);
+        }
+    }
+    GetKernels().transform(X(), Y(), Z(), Size(), affine);
+}
+
+void Vector3Stream::TransformDirections(const Matrix3& matrix) {
+    float affine[12] = {};
+    for (int col = 0; col < 3; ++col) {
+        for (int row = 0; row < 3; ++row) {
+            affine[col * 3 + row] = matrix(row, col);
+        }
+    }
+    GetKernels().transform(X(), Y(), Z(), Size(), affine);
+}
+
+bool Vector3Stream::MinMax(Vector3& min, Vector3& max) const {
+    if (Empty()) {
+        min = Vector3::Zero;
+        max = Vector3::Zero;
+        return false;
+    }
+
+    const StreamKernels& kernels = GetKernels();
+    min = max = Get(0);
+    kernels.minMax(X(), Size(), min.x, max.x);
+    kernels.minMax(Y(), Size(), min.y, max.y);
+    kernels.minMax(Z(), Size(), min.z, max.z);
+    return true;
+}
+
+}
@@ -0,0 +1,35 @@
+#include "Rendering/IRenderer.h"
+#include "Geometry/LODGroup.h"
+#include "Geometry/PackedMesh.h"
+
+namespace Rendering {
+
+const Math3D::Matrix4& IRenderer::GetProjectionMatrix() const {
+    static const Math3D::Matrix4 unknown;
+    return unknown;
+}
+
+const Math3D::Matrix4& IRenderer::GetViewMatrix() const {
+    static const Math3D::Matrix4 identity = Math3D::Matrix4::Identity();
+    return identity;
+}
+
+void IRenderer::DrawPackedMesh(const Geometry::PackedMesh& mesh, const Math3D::Matrix4& transform) {
+    DrawMesh(mesh.Decode(), transform);
+}
+
+void IRenderer::DrawLODGroup(Geometry::LODGroup& group, const Math3D::Matrix4& transform) {
+    if (group.Empty()) {
+        return;
+    }
+    const Math3D::Matrix4 modelView = GetViewMatrix() * transform;
+    size_t level = group.SelectLevel(GetProjectionMatrix(), modelView, static_cast<float>(GetHeight()));
+    DrawMesh(group.GetLevel(level).mesh, transform);
+}
+
+void IRenderer::DrawMeshlets(const Geometry::Mesh& mesh, const Geometry::MeshletMesh& /*meshlets*/,
+                             const Math3D::Matrix4& transform) {
+    DrawMesh(mesh, transform);
+}
+
+}
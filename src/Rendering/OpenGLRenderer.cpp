@@ -29,7 +29,8 @@ void main() {
 )";
 
 OpenGLRenderer::OpenGLRenderer() 
-    : m_window(nullptr), m_width(0), m_height(0), m_shaderProgram(0) {
+    : m_window(nullptr), m_width(0), m_height(0), m_projection(Math3D::Matrix4::Identity()),
+      m_view(Math3D::Matrix4::Identity()), m_shaderProgram(0) {
 }
 
 OpenGLRenderer::~OpenGLRenderer() {
@@ -112,7 +113,8 @@ void OpenGLRenderer::DrawMesh(const Geometry::Mesh& mesh, const Math3D::Matrix4&
     if (firstTime) {
         firstTime = false;
         
-        const auto& vertices = mesh.vertices;
+        std::vector<Geometry::Vertex> vertices;
+        mesh.CopyVerticesTo(vertices);
         const auto& indices = mesh.indices;
         
         glGenVertexArrays(1, &vao);
@@ -144,6 +146,13 @@ void OpenGLRenderer::DrawMesh(const Geometry::Mesh& mesh, const Math3D::Matrix4&
         glUniformMatrix4fv(modelLoc, 1, GL_FALSE, transform.Data());
     }
     
+    GLint normalLoc = glGetUniformLocation(m_shaderProgram, "uNormalMatrix");
+    
+    if (normalLoc != -1) {
+        Math3D::Matrix3 normalMatrix = transform.NormalMatrix();
+        glUniformMatrix3fv(normalLoc, 1, GL_FALSE, normalMatrix.Data());
+    }
+    
     glBindVertexArray(vao);
     glDrawElements(GL_TRIANGLES, mesh.indices.size(), GL_UNSIGNED_INT, 0);
     glBindVertexArray(0);
@@ -164,8 +173,12 @@ void OpenGLRenderer::DisableState(RenderState state) {}
 void OpenGLRenderer::SetViewport(int x, int y, int width, int height) {
     glViewport(x, y, width, height);
 }
-void OpenGLRenderer::SetProjectionMatrix(const Math3D::Matrix4& projection) {}
-void OpenGLRenderer::SetViewMatrix(const Math3D::Matrix4& view) {}
+void OpenGLRenderer::SetProjectionMatrix(const Math3D::Matrix4& projection) {
+    m_projection = projection;
+}
+void OpenGLRenderer::SetViewMatrix(const Math3D::Matrix4& view) {
+    m_view = view;
+}
 void OpenGLRenderer::Resize(int width, int height) {
     m_width = width; 
     m_height = height;
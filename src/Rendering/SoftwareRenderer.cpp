@@ -0,0 +1,595 @@
+#include "Rendering/SoftwareRenderer.h"
+#include "Geometry/Frustum.h"
+#include "Math3D/Matrix3.h"
+#include "Math3D/MathUtils.h"
+#include <algorithm>
+#include <cmath>
+
+namespace Rendering {
+
+namespace {
+
+const size_t VERTEX_CHUNK_SIZE = 4096;
+const size_t TRIANGLE_CHUNK_SIZE = 2048;
+const float AMBIENT_INTENSITY = 0.2f;
+const float WIREFRAME_WIDTH = 1.0f;
+
+uint8_t ToByte(float value) {
+    return static_cast<uint8_t>(Math3D::MathUtils::Clamp(value, 0.0f, 1.0f) * 255.0f + 0.5f);
+}
+
+uint32_t ShadeColor(uint32_t color, float intensity) {
+    intensity = Math3D::MathUtils::Clamp(intensity, 0.0f, 1.0f);
+    uint32_t r = static_cast<uint32_t>((color & 0xFF) * intensity);
+    uint32_t g = static_cast<uint32_t>(((color >> 8) & 0xFF) * intensity);
+    uint32_t b = static_cast<uint32_t>(((color >> 16) & 0xFF) * intensity);
+    return (color & 0xFF000000u) | (b << 16) | (g << 8) | r;
+}
+
+float DiffuseIntensity(const Math3D::Vector3& normal, const Math3D::Vector3& toLight) {
+    return AMBIENT_INTENSITY + (1.0f - AMBIENT_INTENSITY) * std::max(0.0f, normal.Dot(toLight));
+}
+
+uint32_t BlendColor(uint32_t src, uint32_t dst) {
+    uint32_t alpha = src >> 24;
+    uint32_t invAlpha = 255 - alpha;
+    uint32_t result = 0xFF000000u;
+    for (int shift = 0; shift < 24; shift += 8) {
+        uint32_t s = (src >> shift) & 0xFF;
+        uint32_t d = (dst >> shift) & 0xFF;
+        result |= ((s * alpha + d * invAlpha + 127) / 255) << shift;
+    }
+    return result;
+}
+
+}
+
+SoftwareRenderer::SoftwareRenderer(size_t threadCount)
+    : m_threadPool(threadCount),
+      m_projection(Math3D::Matrix4::Identity()),
+      m_view(Math3D::Matrix4::Identity()),
+      m_currentState(RenderState::DepthTest),
+      m_drawColor(Color::White()),
+      m_lightDirection(Math3D::Vector3(-0.3f, -0.5f, -1.0f).Normalized()) {
+}
+
+bool SoftwareRenderer::Initialize(int width, int height, const char* /*title*/) {
+    if (width <= 0 || height <= 0) {
+        return false;
+    }
+
+    AllocateBuffers(width, height);
+    Clear(ClearFlags::Color | ClearFlags::Depth);
+    return true;
+}
+
+void SoftwareRenderer::Shutdown() {
+    m_triangles.clear();
+    m_bins.clear();
+    m_colorBuffer.clear();
+    m_depthBuffer.clear();
+    m_width = 0;
+    m_height = 0;
+}
+
+void SoftwareRenderer::Resize(int width, int height) {
+    if (width <= 0 || height <= 0) {
+        return;
+    }
+
+    m_triangles.clear();
+    AllocateBuffers(width, height);
+    Clear(ClearFlags::Color | ClearFlags::Depth);
+}
+
+void SoftwareRenderer::AllocateBuffers(int width, int height) {
+    m_width = width;
+    m_height = height;
+    m_colorBuffer.assign(static_cast<size_t>(width) * height, 0);
+    m_depthBuffer.assign(static_cast<size_t>(width) * height, 1.0f);
+
+    m_tilesX = (width + TILE_SIZE - 1) / TILE_SIZE;
+    m_tilesY = (height + TILE_SIZE - 1) / TILE_SIZE;
+    m_bins.assign(static_cast<size_t>(m_tilesX) * m_tilesY, std::vector<uint32_t>());
+
+    SetViewport(0, 0, width, height);
+}
+
+void SoftwareRenderer::BeginFrame() {}
+
+void SoftwareRenderer::EndFrame() {
+    Flush();
+}
+
+void SoftwareRenderer::Clear(ClearFlags flags, const Color& color) {
+    Flush();
+
+    if (HasFlag(flags, ClearFlags::Color)) {
+        m_clearColor = PackColor(color);
+        std::fill(m_colorBuffer.begin(), m_colorBuffer.end(), m_clearColor);
+    }
+    if (HasFlag(flags, ClearFlags::Depth)) {
+        std::fill(m_depthBuffer.begin(), m_depthBuffer.end(), 1.0f);
+    }
+}
+
+void SoftwareRenderer::SetRenderState(RenderState state) {
+    m_currentState = state;
+}
+
+void SoftwareRenderer::EnableState(RenderState state) {
+    m_currentState = m_currentState | state;
+}
+
+void SoftwareRenderer::DisableState(RenderState state) {
+    m_currentState = m_currentState & ~state;
+}
+
+void SoftwareRenderer::SetViewport(int x, int y, int width, int height) {
+    m_viewportX = x;
+    m_viewportY = y;
+    m_viewportWidth = std::max(width, 0);
+    m_viewportHeight = std::max(height, 0);
+}
+
+void SoftwareRenderer::SetProjectionMatrix(const Math3D::Matrix4& projection) {
+    m_projection = projection;
+}
+
+void SoftwareRenderer::SetViewMatrix(const Math3D::Matrix4& view) {
+    m_view = view;
+}
+
+void SoftwareRenderer::SetLightDirection(const Math3D::Vector3& direction) {
+    m_lightDirection = direction.Normalized();
+}
+
+void SoftwareRenderer::ResetStatistics() {
+    m_drawCallCount = 0;
+    m_triangleCount = 0;
+    m_culledMeshCount = 0;
+    m_lodTrianglesSaved = 0;
+    m_culledClusterCount = 0;
+}
+
+uint32_t SoftwareRenderer::PackColor(const Color& color) {
+    return static_cast<uint32_t>(ToByte(color.r)) |
+           (static_cast<uint32_t>(ToByte(color.g)) << 8) |
+           (static_cast<uint32_t>(ToByte(color.b)) << 16) |
+           (static_cast<uint32_t>(ToByte(color.a)) << 24);
+}
+
+Color SoftwareRenderer::UnpackColor(uint32_t packed) {
+    return Color((packed & 0xFF) / 255.0f,
+                 ((packed >> 8) & 0xFF) / 255.0f,
+                 ((packed >> 16) & 0xFF) / 255.0f,
+                 ((packed >> 24) & 0xFF) / 255.0f);
+}
+
+void SoftwareRenderer::DrawMesh(const Geometry::Mesh& mesh) {
+    DrawMesh(mesh, Math3D::Matrix4::Identity());
+}
+
+void SoftwareRenderer::DrawMesh(const Geometry::Mesh& mesh, const Math3D::Matrix4& transform) {
+    if (m_width == 0 || m_height == 0 || !mesh.IsValid()) {
+        return;
+    }
+
+    const Math3D::Matrix4 mvp = m_projection * m_view * transform;
+    if (!BeginDraw(mesh.bounds, mvp, mesh.GetTriangleCount())) {
+        return;
+    }
+
+    const Math3D::Matrix3 normalMatrix = transform.NormalMatrix();
+    const Math3D::Vector3 toLight = -m_lightDirection;
+
+    const size_t vertexCount = mesh.GetVertexCount();
+    const bool streamed = mesh.GetLayout() == Geometry::VertexLayout::Streams;
+    m_clipVertices.resize(vertexCount);
+
+    const size_t vertexChunks = (vertexCount + VERTEX_CHUNK_SIZE - 1) / VERTEX_CHUNK_SIZE;
+    m_threadPool.ParallelFor(vertexChunks, [&](size_t chunk) {
+        size_t begin = chunk * VERTEX_CHUNK_SIZE;
+        size_t end = std::min(begin + VERTEX_CHUNK_SIZE, vertexCount);
+        for (size_t i = begin; i < end; ++i) {
+            const Math3D::Vector3 position = streamed ? mesh.streams.positions.Get(i) : mesh.vertices[i].position;
+            const Math3D::Vector3 vertexNormal = streamed ? mesh.streams.normals.Get(i) : mesh.vertices[i].normal;
+            ClipVertex& out = m_clipVertices[i];
+            out.position = mvp * Math3D::Vector4(position, 1.0f);
+            out.intensity = DiffuseIntensity((normalMatrix * vertexNormal).Normalized(), toLight);
+        }
+    });
+
+    AssembleTriangles(mesh.indices, vertexCount);
+}
+
+void SoftwareRenderer::DrawPackedMesh(const Geometry::PackedMesh& mesh, const Math3D::Matrix4& transform) {
+    if (m_width == 0 || m_height == 0 || !mesh.IsValid()) {
+        return;
+    }
+
+    const Math3D::Matrix4 mvp = m_projection * m_view * transform;
+    if (!BeginDraw(mesh.bounds, mvp, mesh.GetTriangleCount())) {
+        return;
+    }
+
+    const Math3D::Matrix4 quantizedMvp = mvp * mesh.GetDequantizationMatrix();
+    const Math3D::Matrix3 normalMatrix = transform.NormalMatrix();
+    const Math3D::Vector3 toLight = -m_lightDirection;
+
+    const size_t vertexCount = mesh.GetVertexCount();
+    m_clipVertices.resize(vertexCount);
+
+    const size_t vertexChunks = (vertexCount + VERTEX_CHUNK_SIZE - 1) / VERTEX_CHUNK_SIZE;
+    m_threadPool.ParallelFor(vertexChunks, [&](size_t chunk) {
+        size_t begin = chunk * VERTEX_CHUNK_SIZE;
+        size_t end = std::min(begin + VERTEX_CHUNK_SIZE, vertexCount);
+        for (size_t i = begin; i < end; ++i) {
+            const Geometry::PackedVertex& vertex = mesh.vertices[i];
+            ClipVertex& out = m_clipVertices[i];
+            out.position = quantizedMvp * Math3D::Vector4(static_cast<float>(vertex.position[0]),
+                                                          static_cast<float>(vertex.position[1]),
+                                                          static_cast<float>(vertex.position[2]), 1.0f);
+            Math3D::Vector3 normal = Geometry::PackedVertex::DecodeDirection(vertex.normal);
+            out.intensity = DiffuseIntensity((normalMatrix * normal).Normalized(), toLight);
+        }
+    });
+
+    AssembleTriangles(mesh.indices, vertexCount);
+}
+
+void SoftwareRenderer::DrawMeshlets(const Geometry::Mesh& mesh, const Geometry::MeshletMesh& meshlets,
+                                    const Math3D::Matrix4& transform) {
+    if (m_width == 0 || m_height == 0 || !mesh.IsValid() || meshlets.Empty()) {
+        return;
+    }
+
+    const Math3D::Matrix4 modelView = m_view * transform;
+    const Math3D::Matrix4 mvp = m_projection * modelView;
+    const Geometry::Frustum frustum(mvp);
+    if (mesh.bounds.IsValid() && !frustum.IntersectsBox(mesh.bounds)) {
+        m_culledMeshCount++;
+        return;
+    }
+
+    Math3D::Vector3 cameraPosition;
+    const bool coneCulling = HasFlag(m_currentState, RenderState::FaceCulling) && m_projection(3, 2) != 0.0f;
+    if (coneCulling) {
+        Math3D::Vector4 eye = modelView.Inverted() * Math3D::Vector4(0.0f, 0.0f, 0.0f, 1.0f);
+        cameraPosition = Math3D::Vector3(eye.x, eye.y, eye.z) / eye.w;
+    }
+
+    const size_t visibleCount = meshlets.Cull(frustum, coneCulling ? &cameraPosition : nullptr, m_visibleMeshlets);
+    m_culledClusterCount += static_cast<int>(meshlets.GetMeshletCount() - visibleCount);
+    if (visibleCount == 0) {
+        m_culledMeshCount++;
+        return;
+    }
+
+    m_clusterOffsets.resize(visibleCount * 2 + 2);
+    m_clusterOffsets[0] = 0;
+    m_clusterOffsets[1] = 0;
+    for (size_t i = 0; i < visibleCount; ++i) {
+        const Geometry::Meshlet& meshlet = meshlets.meshlets[m_visibleMeshlets[i]];
+        m_clusterOffsets[i * 2 + 2] = m_clusterOffsets[i * 2] + meshlet.vertexCount;
+        m_clusterOffsets[i * 2 + 3] = m_clusterOffsets[i * 2 + 1] + meshlet.triangleCount;
+    }
+    const size_t vertexCount = m_clusterOffsets[visibleCount * 2];
+    const size_t triangleCount = m_clusterOffsets[visibleCount * 2 + 1];
+
+    m_drawCallCount++;
+    m_triangleCount += static_cast<int>(triangleCount);
+
+    const Math3D::Matrix3 normalMatrix = transform.NormalMatrix();
+    const Math3D::Vector3 toLight = -m_lightDirection;
+    const bool streamed = mesh.GetLayout() == Geometry::VertexLayout::Streams;
+    m_clipVertices.resize(vertexCount);
+    m_clusterIndices.resize(triangleCount * 3);
+
+    m_threadPool.ParallelFor(visibleCount, [&](size_t i) {
+        const Geometry::Meshlet& meshlet = meshlets.meshlets[m_visibleMeshlets[i]];
+        const uint32_t vertexBase = m_clusterOffsets[i * 2];
+        const uint32_t triangleBase = m_clusterOffsets[i * 2 + 1];
+        for (uint32_t v = 0; v < meshlet.vertexCount; ++v) {
+            const uint32_t index = meshlets.vertices[meshlet.vertexOffset + v];
+            const Math3D::Vector3 position = streamed ? mesh.streams.positions.Get(index)
+                                                      : mesh.vertices[index].position;
+            const Math3D::Vector3 vertexNormal = streamed ? mesh.streams.normals.Get(index)
+                                                          : mesh.vertices[index].normal;
+            ClipVertex& out = m_clipVertices[vertexBase + v];
+            out.position = mvp * Math3D::Vector4(position, 1.0f);
+            out.intensity = DiffuseIntensity((normalMatrix * vertexNormal).Normalized(), toLight);
+        }
+        const uint8_t* local = meshlets.triangles.data() + static_cast<size_t>(meshlet.triangleOffset) * 3;
+        uint32_t* out = m_clusterIndices.data() + static_cast<size_t>(triangleBase) * 3;
+        for (uint32_t k = 0; k < meshlet.triangleCount * 3; ++k) {
+            out[k] = vertexBase + local[k];
+        }
+    });
+
+    AssembleTriangles(m_clusterIndices, vertexCount);
+}
+
+void SoftwareRenderer::DrawLODGroup(Geometry::LODGroup& group, const Math3D::Matrix4& transform) {
+    if (group.Empty()) {
+        return;
+    }
+
+    const size_t level = group.SelectLevel(m_projection, m_view * transform, static_cast<float>(m_viewportHeight));
+    const int drawCalls = m_drawCallCount;
+    DrawMesh(group.GetLevel(level).mesh, transform);
+    if (m_drawCallCount != drawCalls) {
+        m_lodTrianglesSaved += static_cast<int>(group.GetLevel(0).mesh.GetTriangleCount() -
+                                                group.GetLevel(level).mesh.GetTriangleCount());
+    }
+}
+
+bool SoftwareRenderer::BeginDraw(const Geometry::BoundingBox& bounds, const Math3D::Matrix4& mvp, size_t triangleCount) {
+    if (bounds.IsValid() && !Geometry::Frustum(mvp).IntersectsBox(bounds)) {
+        m_culledMeshCount++;
+        return false;
+    }
+
+    m_drawCallCount++;
+    m_triangleCount += static_cast<int>(triangleCount);
+    return true;
+}
+
+void SoftwareRenderer::AssembleTriangles(const std::vector<uint32_t>& indices, size_t vertexCount) {
+    const uint32_t color = PackColor(m_drawColor);
+    const size_t triangleCount = indices.empty() ? vertexCount / 3 : indices.size() / 3;
+    m_setupScratch.resize(triangleCount * 2);
+    m_setupCounts.assign(triangleCount, 0);
+
+    const size_t triangleChunks = (triangleCount + TRIANGLE_CHUNK_SIZE - 1) / TRIANGLE_CHUNK_SIZE;
+    m_threadPool.ParallelFor(triangleChunks, [&](size_t chunk) {
+        size_t begin = chunk * TRIANGLE_CHUNK_SIZE;
+        size_t end = std::min(begin + TRIANGLE_CHUNK_SIZE, triangleCount);
+        for (size_t t = begin; t < end; ++t) {
+            uint32_t idx[3];
+            for (int k = 0; k < 3; ++k) {
+                idx[k] = indices.empty() ? static_cast<uint32_t>(t * 3 + k) : indices[t * 3 + k];
+            }
+            if (idx[0] >= vertexCount || idx[1] >= vertexCount || idx[2] >= vertexCount) {
+                continue;
+            }
+
+            ClipVertex input[3] = { m_clipVertices[idx[0]], m_clipVertices[idx[1]], m_clipVertices[idx[2]] };
+
+            bool outside = false;
+            for (int axis = 0; axis < 3 && !outside; ++axis) {
+                int above = 0, below = 0;
+                for (int k = 0; k < 3; ++k) {
+                    const Math3D::Vector4& p = input[k].position;
+                    float value = axis == 0 ? p.x : (axis == 1 ? p.y : p.z);
+                    if (value > p.w) above++;
+                    if (value < -p.w) below++;
+                }
+                outside = above == 3 || below == 3;
+            }
+            if (outside) {
+                continue;
+            }
+
+            ClipVertex clipped[4];
+            int clippedCount = ClipAgainstNearPlane(input, clipped);
+
+            uint8_t produced = 0;
+            for (int k = 1; k + 1 < clippedCount; ++k) {
+                if (SetupTriangle(clipped[0], clipped[k], clipped[k + 1], color,
+                                  m_setupScratch[t * 2 + produced])) {
+                    produced++;
+                }
+            }
+            m_setupCounts[t] = produced;
+        }
+    });
+
+    for (size_t t = 0; t < triangleCount; ++t) {
+        for (uint8_t k = 0; k < m_setupCounts[t]; ++k) {
+            BinTriangle(m_setupScratch[t * 2 + k]);
+        }
+    }
+}
+
+int SoftwareRenderer::ClipAgainstNearPlane(const ClipVertex* in, ClipVertex* out) const {
+    int count = 0;
+    for (int i = 0; i < 3; ++i) {
+        const ClipVertex& current = in[i];
+        const ClipVertex& next = in[(i + 1) % 3];
+        float currentDistance = current.position.z + current.position.w;
+        float nextDistance = next.position.z + next.position.w;
+
+        if (currentDistance >= 0.0f) {
+            out[count++] = current;
+        }
+        if ((currentDistance >= 0.0f) != (nextDistance >= 0.0f)) {
+            float t = currentDistance / (currentDistance - nextDistance);
+            ClipVertex& v = out[count++];
+            v.position = current.position + (next.position - current.position) * t;
+            v.intensity = Math3D::MathUtils::Lerp(current.intensity, next.intensity, t);
+        }
+    }
+    return count;
+}
+
+bool SoftwareRenderer::SetupTriangle(const ClipVertex& c0, const ClipVertex& c1, const ClipVertex& c2,
+                                     uint32_t color, RasterTriangle& triangle) const {
+    const ClipVertex* clip[3] = { &c0, &c1, &c2 };
+    float sx[3], sy[3];
+
+    for (int k = 0; k < 3; ++k) {
+        const Math3D::Vector4& p = clip[k]->position;
+        if (p.w <= 0.0f) {
+            return false;
+        }
+        float invW = 1.0f / p.w;
+        sx[k] = m_viewportX + (p.x * invW * 0.5f + 0.5f) * m_viewportWidth;
+        sy[k] = m_viewportY + (0.5f - p.y * invW * 0.5f) * m_viewportHeight;
+        triangle.z[k] = p.z * invW * 0.5f + 0.5f;
+        triangle.invW[k] = invW;
+        triangle.intensity[k] = clip[k]->intensity;
+    }
+
+    float area = (sx[0] - sx[1]) * (sy[2] - sy[1]) - (sy[0] - sy[1]) * (sx[2] - sx[1]);
+    if (!(area != 0.0f) || !std::isfinite(area)) {
+        return false;
+    }
+
+    if (area < 0.0f) {
+        if (HasFlag(m_currentState, RenderState::FaceCulling)) {
+            return false;
+        }
+        std::swap(sx[1], sx[2]);
+        std::swap(sy[1], sy[2]);
+        std::swap(triangle.z[1], triangle.z[2]);
+        std::swap(triangle.invW[1], triangle.invW[2]);
+        std::swap(triangle.intensity[1], triangle.intensity[2]);
+        area = -area;
+    }
+
+    for (int k = 0; k < 3; ++k) {
+        int a = (k + 1) % 3;
+        int b = (k + 2) % 3;
+        float dx = sx[b] - sx[a];
+        float dy = sy[b] - sy[a];
+        triangle.edgeA[k] = dy;
+        triangle.edgeB[k] = -dx;
+        triangle.edgeC[k] = sy[a] * dx - sx[a] * dy;
+        triangle.topLeft[k] = dy > 0.0f || (dy == 0.0f && -dx > 0.0f);
+        float length = std::sqrt(dx * dx + dy * dy);
+        triangle.invEdgeLength[k] = length > 0.0f ? 1.0f / length : 0.0f;
+    }
+
+    int clipMinX = std::max(m_viewportX, 0);
+    int clipMinY = std::max(m_viewportY, 0);
+    int clipMaxX = std::min(m_viewportX + m_viewportWidth, m_width) - 1;
+    int clipMaxY = std::min(m_viewportY + m_viewportHeight, m_height) - 1;
+
+    float minX = std::min({ sx[0], sx[1], sx[2] });
+    float maxX = std::max({ sx[0], sx[1], sx[2] });
+    float minY = std::min({ sy[0], sy[1], sy[2] });
+    float maxY = std::max({ sy[0], sy[1], sy[2] });
+
+    triangle.minX = std::max(clipMinX, static_cast<int>(std::floor(std::max(minX, static_cast<float>(clipMinX)))));
+    triangle.minY = std::max(clipMinY, static_cast<int>(std::floor(std::max(minY, static_cast<float>(clipMinY)))));
+    triangle.maxX = std::min(clipMaxX, static_cast<int>(std::ceil(std::min(maxX, static_cast<float>(clipMaxX + 1)))));
+    triangle.maxY = std::min(clipMaxY, static_cast<int>(std::ceil(std::min(maxY, static_cast<float>(clipMaxY + 1)))));
+
+    if (triangle.minX > triangle.maxX || triangle.minY > triangle.maxY) {
+        return false;
+    }
+
+    triangle.invArea = 1.0f / area;
+    triangle.color = color;
+    triangle.state = m_currentState;
+    return true;
+}
+
+void SoftwareRenderer::BinTriangle(const RasterTriangle& triangle) {
+    uint32_t index = static_cast<uint32_t>(m_triangles.size());
+    m_triangles.push_back(triangle);
+
+    int tileMinX = triangle.minX / TILE_SIZE;
+    int tileMaxX = triangle.maxX / TILE_SIZE;
+    int tileMinY = triangle.minY / TILE_SIZE;
+    int tileMaxY = triangle.maxY / TILE_SIZE;
+
+    for (int ty = tileMinY; ty <= tileMaxY; ++ty) {
+        for (int tx = tileMinX; tx <= tileMaxX; ++tx) {
+            m_bins[ty * m_tilesX + tx].push_back(index);
+        }
+    }
+}
+
+void SoftwareRenderer::Flush() {
+    if (m_triangles.empty()) {
+        return;
+    }
+
+    m_threadPool.ParallelFor(m_bins.size(), [this](size_t tile) {
+        RasterizeTile(static_cast<int>(tile));
+    });
+
+    for (auto& bin : m_bins) {
+        bin.clear();
+    }
+    m_triangles.clear();
+}
+
+void SoftwareRenderer::RasterizeTile(int tileIndex) {
+    const std::vector<uint32_t>& bin = m_bins[tileIndex];
+    if (bin.empty()) {
+        return;
+    }
+
+    const int tileX0 = (tileIndex % m_tilesX) * TILE_SIZE;
+    const int tileY0 = (tileIndex / m_tilesX) * TILE_SIZE;
+    const int tileX1 = std::min(tileX0 + TILE_SIZE, m_width) - 1;
+    const int tileY1 = std::min(tileY0 + TILE_SIZE, m_height) - 1;
+
+    for (uint32_t triangleIndex : bin) {
+        const RasterTriangle& tri = m_triangles[triangleIndex];
+
+        const int x0 = std::max(tri.minX, tileX0);
+        const int x1 = std::min(tri.maxX, tileX1);
+        const int y0 = std::max(tri.minY, tileY0);
+        const int y1 = std::min(tri.maxY, tileY1);
+
+        const bool depthTest = HasFlag(tri.state, RenderState::DepthTest);
+        const bool blending = HasFlag(tri.state, RenderState::Blending) && (tri.color >> 24) != 0xFF;
+        const bool wireframe = HasFlag(tri.state, RenderState::Wireframe);
+
+        for (int y = y0; y <= y1; ++y) {
+            const float py = y + 0.5f;
+            const float px = x0 + 0.5f;
+            float w[3];
+            for (int k = 0; k < 3; ++k) {
+                w[k] = tri.edgeA[k] * px + tri.edgeB[k] * py + tri.edgeC[k];
+            }
+
+            const size_t rowOffset = static_cast<size_t>(y) * m_width;
+            for (int x = x0; x <= x1; ++x) {
+                bool inside = true;
+                for (int k = 0; k < 3; ++k) {
+                    inside = inside && (w[k] > 0.0f || (w[k] == 0.0f && tri.topLeft[k]));
+                }
+
+                if (inside && wireframe) {
+                    float edgeDistance = std::min({ w[0] * tri.invEdgeLength[0],
+                                                    w[1] * tri.invEdgeLength[1],
+                                                    w[2] * tri.invEdgeLength[2] });
+                    inside = edgeDistance < WIREFRAME_WIDTH;
+                }
+
+                if (inside) {
+                    float l0 = w[0] * tri.invArea;
+                    float l1 = w[1] * tri.invArea;
+                    float l2 = w[2] * tri.invArea;
+                    float z = l0 * tri.z[0] + l1 * tri.z[1] + l2 * tri.z[2];
+
+                    const size_t offset = rowOffset + x;
+                    if (z >= 0.0f && z <= 1.0f && (!depthTest || z < m_depthBuffer[offset])) {
+                        float p0 = l0 * tri.invW[0];
+                        float p1 = l1 * tri.invW[1];
+                        float p2 = l2 * tri.invW[2];
+                        float intensity = (p0 * tri.intensity[0] + p1 * tri.intensity[1] + p2 * tri.intensity[2]) /
+                                          (p0 + p1 + p2);
+
+                        uint32_t shaded = ShadeColor(tri.color, intensity);
+                        m_colorBuffer[offset] = blending ? BlendColor(shaded, m_colorBuffer[offset]) : shaded;
+                        if (depthTest) {
+                            m_depthBuffer[offset] = z;
+                        }
+                    }
+                }
+
+                w[0] += tri.edgeA[0];
+                w[1] += tri.edgeA[1];
+                w[2] += tri.edgeA[2];
+            }
+        }
+    }
+}
+
+}
@@ -0,0 +1,422 @@
+#include "Rendering/TerminalRenderer.h"
+#include <cerrno>
+#include <cstring>
+#include <sys/ioctl.h>
+#include <unistd.h>
+#include <utility>
+
+#if defined(__SSE2__) || defined(_M_X64)
+#include <emmintrin.h>
+#define TERM3D_TERMINAL_SSE2 1
+#endif
+
+namespace Rendering {
+
+namespace {
+
+const int DEFAULT_COLUMNS = 80;
+const int DEFAULT_ROWS = 24;
+
+const char ENTER_SEQUENCE[] = "\x1b[?25l";
+const char EXIT_SEQUENCE[] = "\x1b[0m\x1b[?25h\n";
+const uint32_t UPPER_HALF_BLOCK = 0x2580;
+const uint32_t BRAILLE_BASE = 0x2800;
+const uint32_t BLANK = ' ';
+const uint32_t UNKNOWN_COLOR = 0xFFFFFFFFu;
+
+const uint8_t BRAILLE_DOTS[4][4] = {
+    { 0x00, 0x01, 0x08, 0x09 },
+    { 0x00, 0x02, 0x10, 0x12 },
+    { 0x00, 0x04, 0x20, 0x24 },
+    { 0x00, 0x40, 0x80, 0xC0 }
+};
+
+const char CLEAR_SCREEN[] = "\x1b[2J";
+
+const size_t MAX_CURSOR_MOVE_BYTES = 32;
+const size_t MAX_CELL_BYTES = MAX_CURSOR_MOVE_BYTES + 19 + 19 + 3;
+const size_t MAX_FRAME_PREFIX_BYTES = 4;
+const int MAX_REEMITTED_GAP = 2;
+
+struct DecimalTable {
+    char text[256][3];
+    uint8_t length[256];
+
+    DecimalTable() {
+        for (int value = 0; value < 256; ++value) {
+            if (value >= 100) {
+                text[value][0] = static_cast<char>('0' + value / 100);
+                text[value][1] = static_cast<char>('0' + (value / 10) % 10);
+                text[value][2] = static_cast<char>('0' + value % 10);
+                length[value] = 3;
+            } else if (value >= 10) {
+                text[value][0] = static_cast<char>('0' + value / 10);
+                text[value][1] = static_cast<char>('0' + value % 10);
+                length[value] = 2;
+            } else {
+                text[value][0] = static_cast<char>('0' + value);
+                length[value] = 1;
+            }
+        }
+    }
+};
+
+const DecimalTable s_decimal;
+
+char* AppendLiteral(char* out, const char* text, size_t length) {
+    std::memcpy(out, text, length);
+    return out + length;
+}
+
+char* AppendByte(char* out, uint32_t value) {
+    value &= 0xFF;
+    std::memcpy(out, s_decimal.text[value], 3);
+    return out + s_decimal.length[value];
+}
+
+char* AppendInt(char* out, int value) {
+    char digits[12];
+    int count = 0;
+    do {
+        digits[count++] = static_cast<char>('0' + value % 10);
+        value /= 10;
+    } while (value > 0);
+    while (count > 0) {
+        *out++ = digits[--count];
+    }
+    return out;
+}
+
+char* AppendColor(char* out, char layer, uint32_t color) {
+    out = AppendLiteral(out, "\x1b[", 2);
+    *out++ = layer;
+    out = AppendLiteral(out, "8;2;", 4);
+    out = AppendByte(out, color);
+    *out++ = ';';
+    out = AppendByte(out, color >> 8);
+    *out++ = ';';
+    out = AppendByte(out, color >> 16);
+    *out++ = 'm';
+    return out;
+}
+
+char* AppendGlyph(char* out, uint32_t codePoint) {
+    if (codePoint < 0x80) {
+        *out++ = static_cast<char>(codePoint);
+    } else {
+        *out++ = static_cast<char>(0xE0 | (codePoint >> 12));
+        *out++ = static_cast<char>(0x80 | ((codePoint >> 6) & 0x3F));
+        *out++ = static_cast<char>(0x80 | (codePoint & 0x3F));
+    }
+    return out;
+}
+
+uint32_t Luminance(uint32_t color) {
+    return ((color & 0xFF) * 54 + ((color >> 8) & 0xFF) * 183 + ((color >> 16) & 0xFF) * 19) >> 8;
+}
+
+void ThresholdRow(const uint32_t* pixels, const float* depths, int count, int lowerBound, int upperBound,
+                  uint8_t* coverage) {
+    int x = 0;
+#ifdef TERM3D_TERMINAL_SSE2
+    const __m128i byteMask = _mm_set1_epi32(0xFF);
+    const __m128i redWeight = _mm_set1_epi32(54);
+    const __m128i greenWeight = _mm_set1_epi32(183);
+    const __m128i blueWeight = _mm_set1_epi32(19);
+    const __m128i lower = _mm_set1_epi32(lowerBound);
+    const __m128i upper = _mm_set1_epi32(upperBound);
+    const __m128 farDepth = _mm_set1_ps(1.0f);
+
+    for (; x + 4 <= count; x += 4) {
+        __m128i color = _mm_loadu_si128(reinterpret_cast<const __m128i*>(pixels + x));
+        __m128i r = _mm_and_si128(color, byteMask);
+        __m128i g = _mm_and_si128(_mm_srli_epi32(color, 8), byteMask);
+        __m128i b = _mm_and_si128(_mm_srli_epi32(color, 16), byteMask);
+
+        __m128i luminance = _mm_add_epi32(_mm_add_epi32(_mm_mullo_epi16(r, redWeight),
+                                                        _mm_mullo_epi16(g, greenWeight)),
+                                          _mm_mullo_epi16(b, blueWeight));
+        luminance = _mm_srli_epi32(luminance, 8);
+
+        __m128i contrast = _mm_or_si128(_mm_cmpgt_epi32(luminance, upper), _mm_cmplt_epi32(luminance, lower));
+        __m128 drawn = _mm_cmplt_ps(_mm_loadu_ps(depths + x), farDepth);
+        int bits = _mm_movemask_ps(_mm_or_ps(_mm_castsi128_ps(contrast), drawn));
+        coverage[x / 2] = static_cast<uint8_t>(bits & 3);
+        coverage[x / 2 + 1] = static_cast<uint8_t>(bits >> 2);
+    }
+#endif
+    for (; x < count; x += 2) {
+        uint8_t bits = 0;
+        for (int k = 0; k < 2 && x + k < count; ++k) {
+            int luminance = static_cast<int>(Luminance(pixels[x + k]));
+            if (luminance > upperBound || luminance < lowerBound || depths[x + k] < 1.0f) {
+                bits |= static_cast<uint8_t>(1 << k);
+            }
+        }
+        coverage[x / 2] = bits;
+    }
+}
+
+uint32_t AverageColor(const uint32_t* sum, int count) {
+    if (count == 0) {
+        return 0;
+    }
+    return (sum[0] / count) | ((sum[1] / count) << 8) | ((sum[2] / count) << 16);
+}
+
+char* AppendCursorMove(char* out, int row, int column) {
+    out = AppendLiteral(out, "\x1b[", 2);
+    out = AppendInt(out, row + 1);
+    *out++ = ';';
+    out = AppendInt(out, column + 1);
+    *out++ = 'H';
+    return out;
+}
+
+}
+
+TerminalRenderer::TerminalRenderer(int outputFd, size_t threadCount)
+    : SoftwareRenderer(threadCount), m_outputFd(outputFd) {
+}
+
+TerminalRenderer::~TerminalRenderer() {
+    if (m_initialized) {
+        Shutdown();
+    }
+}
+
+bool TerminalRenderer::QueryTerminalSize(int outputFd, int& columns, int& rows) {
+    struct winsize size;
+    if (ioctl(outputFd, TIOCGWINSZ, &size) != 0 || size.ws_col == 0 || size.ws_row == 0) {
+        return false;
+    }
+
+    columns = size.ws_col;
+    rows = size.ws_row;
+    return true;
+}
+
+bool TerminalRenderer::Initialize(int columns, int rows, const char* title) {
+    if (columns <= 0 || rows <= 0) {
+        if (!QueryTerminalSize(m_outputFd, columns, rows)) {
+            columns = DEFAULT_COLUMNS;
+            rows = DEFAULT_ROWS;
+        }
+    }
+
+    if (!SoftwareRenderer::Initialize(columns * GetPixelsPerCellX(), rows * GetPixelsPerCellY(), title)) {
+        return false;
+    }
+
+    m_columns = columns;
+    m_rows = rows;
+    AllocateFrameBuffer();
+
+    m_initialized = true;
+    return WriteBytes(ENTER_SEQUENCE, sizeof(ENTER_SEQUENCE) - 1);
+}
+
+void TerminalRenderer::Shutdown() {
+    if (m_initialized) {
+        WriteBytes(EXIT_SEQUENCE, sizeof(EXIT_SEQUENCE) - 1);
+        m_initialized = false;
+    }
+
+    m_frameBuffer.clear();
+    m_frameSize = 0;
+    m_columns = 0;
+    m_rows = 0;
+    SoftwareRenderer::Shutdown();
+}
+
+void TerminalRenderer::Resize(int columns, int rows) {
+    if (columns <= 0 || rows <= 0) {
+        return;
+    }
+
+    SoftwareRenderer::Resize(columns * GetPixelsPerCellX(), rows * GetPixelsPerCellY());
+    m_columns = columns;
+    m_rows = rows;
+    AllocateFrameBuffer();
+}
+
+void TerminalRenderer::SetOutputMode(TerminalOutputMode mode) {
+    if (mode == m_outputMode) {
+        return;
+    }
+
+    m_outputMode = mode;
+    if (m_columns > 0 && m_rows > 0) {
+        Resize(m_columns, m_rows);
+    }
+}
+
+void TerminalRenderer::AllocateFrameBuffer() {
+    size_t cellCount = static_cast<size_t>(m_rows) * m_columns;
+    m_frameBuffer.assign(MAX_FRAME_PREFIX_BYTES + cellCount * MAX_CELL_BYTES, '\0');
+    m_frameSize = 0;
+
+    m_cells.assign(cellCount, Cell());
+    m_previousCells.assign(cellCount, Cell());
+    m_coverage.assign(static_cast<size_t>(m_width / 2 + 1) * 4, 0);
+    m_fullRedraw = true;
+}
+
+void TerminalRenderer::ResetStatistics() {
+    SoftwareRenderer::ResetStatistics();
+    m_bytesWritten = 0;
+}
+
+void TerminalRenderer::EndFrame() {
+    SoftwareRenderer::EndFrame();
+
+    if (!m_initialized) {
+        return;
+    }
+
+    if (m_outputMode == TerminalOutputMode::Braille) {
+        BuildBrailleCells();
+    } else {
+        BuildHalfBlockCells();
+    }
+    EncodeFrame();
+    std::swap(m_cells, m_previousCells);
+
+    if (m_frameSize > 0 && WriteBytes(m_frameBuffer.data(), m_frameSize)) {
+        m_bytesWritten += static_cast<int>(m_frameSize);
+    }
+}
+
+void TerminalRenderer::BuildHalfBlockCells() {
+    for (int row = 0; row < m_rows; ++row) {
+        const uint32_t* upper = m_colorBuffer.data() + static_cast<size_t>(row * 2) * m_width;
+        const uint32_t* lower = upper + m_width;
+        Cell* cells = m_cells.data() + static_cast<size_t>(row) * m_columns;
+
+        for (int column = 0; column < m_columns; ++column) {
+            cells[column].glyph = UPPER_HALF_BLOCK;
+            cells[column].foreground = upper[column] & 0x00FFFFFFu;
+            cells[column].background = lower[column] & 0x00FFFFFFu;
+        }
+    }
+}
+
+void TerminalRenderer::BuildBrailleCells() {
+    int clearLuminance = static_cast<int>(Luminance(m_clearColor));
+    int threshold = static_cast<int>(m_brailleThreshold * 255.0f);
+    const size_t coverageStride = static_cast<size_t>(m_width / 2 + 1);
+
+    for (int row = 0; row < m_rows; ++row) {
+        const uint32_t* pixels = m_colorBuffer.data() + static_cast<size_t>(row * 4) * m_width;
+        for (int line = 0; line < 4; ++line) {
+            size_t lineOffset = static_cast<size_t>(row * 4 + line) * m_width;
+            ThresholdRow(m_colorBuffer.data() + lineOffset, m_depthBuffer.data() + lineOffset, m_width,
+                         clearLuminance - threshold, clearLuminance + threshold,
+                         m_coverage.data() + line * coverageStride);
+        }
+
+        Cell* cells = m_cells.data() + static_cast<size_t>(row) * m_columns;
+        for (int column = 0; column < m_columns; ++column) {
+            uint32_t mask = 0;
+            uint32_t covered[3] = { 0, 0, 0 };
+            uint32_t uncovered[3] = { 0, 0, 0 };
+            int coveredCount = 0;
+
+            for (int line = 0; line < 4; ++line) {
+                uint8_t bits = m_coverage[line * coverageStride + column];
+                mask |= BRAILLE_DOTS[line][bits];
+
+                const uint32_t* pair = pixels + static_cast<size_t>(line) * m_width + column * 2;
+                for (int k = 0; k < 2; ++k) {
+                    uint32_t* sum = (bits >> k) & 1 ? covered : uncovered;
+                    sum[0] += pair[k] & 0xFF;
+                    sum[1] += (pair[k] >> 8) & 0xFF;
+                    sum[2] += (pair[k] >> 16) & 0xFF;
+                    coveredCount += (bits >> k) & 1;
+                }
+            }
+
+            Cell& cell = cells[column];
+            cell.glyph = mask == 0 ? BLANK : BRAILLE_BASE + mask;
+            cell.foreground = mask == 0 ? 0 : AverageColor(covered, coveredCount);
+            cell.background = coveredCount == 8 ? (m_clearColor & 0x00FFFFFFu) : AverageColor(uncovered, 8 - coveredCount);
+        }
+    }
+}
+
+bool TerminalRenderer::MatchesActiveColors(const Cell& cell) const {
+    return cell.background == m_activeBackground &&
+           (cell.glyph == BLANK || cell.foreground == m_activeForeground);
+}
+
+char* TerminalRenderer::EncodeCell(char* out, const Cell& cell) {
+    if (cell.glyph != BLANK && cell.foreground != m_activeForeground) {
+        out = AppendColor(out, '3', cell.foreground);
+        m_activeForeground = cell.foreground;
+    }
+    if (cell.background != m_activeBackground) {
+        out = AppendColor(out, '4', cell.background);
+        m_activeBackground = cell.background;
+    }
+
+    return AppendGlyph(out, cell.glyph);
+}
+
+void TerminalRenderer::EncodeFrame() {
+    char* out = m_frameBuffer.data();
+
+    if (m_fullRedraw) {
+        out = AppendLiteral(out, CLEAR_SCREEN, sizeof(CLEAR_SCREEN) - 1);
+        m_activeForeground = UNKNOWN_COLOR;
+        m_activeBackground = UNKNOWN_COLOR;
+    }
+
+    for (int row = 0; row < m_rows; ++row) {
+        const Cell* cells = m_cells.data() + static_cast<size_t>(row) * m_columns;
+        const Cell* previous = m_previousCells.data() + static_cast<size_t>(row) * m_columns;
+
+        int cursorColumn = -1;
+        for (int column = 0; column < m_columns; ++column) {
+            if (!m_fullRedraw && cells[column] == previous[column]) {
+                continue;
+            }
+
+            int gap = column - cursorColumn;
+            bool reemitGap = cursorColumn >= 0 && gap <= MAX_REEMITTED_GAP;
+            for (int skipped = cursorColumn; reemitGap && skipped < column; ++skipped) {
+                reemitGap = MatchesActiveColors(cells[skipped]);
+            }
+
+            if (reemitGap) {
+                for (; cursorColumn < column; ++cursorColumn) {
+                    out = AppendGlyph(out, cells[cursorColumn].glyph);
+                }
+            } else if (cursorColumn != column) {
+                out = AppendCursorMove(out, row, column);
+            }
+
+            out = EncodeCell(out, cells[column]);
+            cursorColumn = column + 1 < m_columns ? column + 1 : -1;
+        }
+    }
+
+    m_fullRedraw = false;
+    m_frameSize = static_cast<size_t>(out - m_frameBuffer.data());
+}
+
+bool TerminalRenderer::WriteBytes(const char* data, size_t size) const {
+    while (size > 0) {
+        ssize_t written = write(m_outputFd, data, size);
+        if (written < 0) {
+            if (errno == EINTR) {
+                continue;
+            }
+            return false;
+        }
+        data += written;
+        size -= static_cast<size_t>(written);
+    }
+    return true;
+}
+
+}
@@ -0,0 +1,127 @@
+#include <iostream>
+#include <vector>
+#include "../include/Math3D/AffineTransform.h"
+#include "../include/Math3D/MathUtils.h"
+
+using namespace Math3D;
+
+bool MatricesMatch(const Matrix4& a, const Matrix4& b) {
+    for (int row = 0; row < 4; ++row) {
+        for (int col = 0; col < 4; ++col) {
+            if (!MathUtils::Approximately(a(row, col), b(row, col), 1e-4f)) {
+                return false;
+            }
+        }
+    }
+    return true;
+}
+
+bool VectorsMatch(const Vector3& a, const Vector3& b) {
+    return MathUtils::Approximately(a.x, b.x, 1e-4f) &&
+           MathUtils::Approximately(a.y, b.y, 1e-4f) &&
+           MathUtils::Approximately(a.z, b.z, 1e-4f);
+}
+
+void TestConversion() {
+    std::cout << "Testing AffineTransform conversion..." << std::endl;
+
+    static_assert(sizeof(AffineTransform) * 4 == sizeof(Matrix4) * 3, "AffineTransform must store 12 floats");
+    static_assert(AffineTransform::Translation(Vector3(1.0f, 2.0f, 3.0f)).TransformPoint(Vector3::Zero) == Vector3(1.0f, 2.0f, 3.0f),
+                  "Translation must be constexpr");
+
+    Quaternion rotation = Quaternion::FromEuler(0.3f, -1.2f, 0.7f);
+    Vector3 translation(4.0f, -2.0f, 0.5f);
+    Vector3 scale(2.0f, 0.5f, 3.0f);
+
+    Matrix4 expected = Matrix4::Translation(translation) * rotation.ToMatrix4() * Matrix4::Scaling(scale);
+    AffineTransform trs = AffineTransform::FromTRS(translation, rotation, scale);
+    AffineTransform composed = AffineTransform::Translation(translation) *
+                               AffineTransform::Rotation(rotation) *
+                               AffineTransform::Scaling(scale);
+
+    bool toMatrix = MatricesMatch(trs.ToMatrix4(), expected) && MatricesMatch(composed.ToMatrix4(), expected);
+    bool roundTrip = AffineTransform(expected) == trs;
+    bool parts = VectorsMatch(trs.GetTranslation(), translation) &&
+                 VectorsMatch(trs.GetLinear() * Vector3::UnitX, rotation.Rotate(Vector3::UnitX) * scale.x);
+
+    if (toMatrix && roundTrip && parts) {
+        std::cout << "AffineTransform conversion test passed" << std::endl;
+    } else {
+        std::cout << "AffineTransform conversion test failed" << std::endl;
+    }
+}
+
+void TestTransformAndInverse() {
+    std::cout << "Testing AffineTransform transforms and inverse..." << std::endl;
+
+    AffineTransform transform = AffineTransform::FromTRS(Vector3(-1.0f, 3.0f, 2.0f),
+                                                         Quaternion::FromAxisAngle(Vector3(1.0f, 1.0f, 0.0f), 0.9f),
+                                                         Vector3(1.5f, 2.0f, 0.25f));
+    Matrix4 matrix = transform.ToMatrix4();
+
+    std::vector<Vector3> points(11), batched(11);
+    bool transforms = true;
+    for (size_t i = 0; i < points.size(); ++i) {
+        float s = static_cast<float>(i);
+        points[i] = Vector3(s * 0.5f - 2.0f, 1.0f - s * 0.25f, s);
+        transforms &= VectorsMatch(transform.TransformPoint(points[i]), (matrix * Vector4(points[i], 1.0f)).XYZ());
+        transforms &= VectorsMatch(transform.TransformDirection(points[i]), (matrix * Vector4(points[i], 0.0f)).XYZ());
+    }
+    transform.TransformPoints(points.data(), batched.data(), points.size());
+    for (size_t i = 0; i < points.size(); ++i) {
+        transforms &= VectorsMatch(batched[i], transform.TransformPoint(points[i]));
+    }
+
+    bool inverse = (transform * transform.Inverted()) == AffineTransform::Identity() &&
+                   MatricesMatch(transform.Inverted().ToMatrix4(), matrix.Inverted());
+    bool singular = AffineTransform::Scaling(Vector3(1.0f, 0.0f, 1.0f)).Inverted() == AffineTransform::Identity();
+
+    if (transforms) {
+        std::cout << "AffineTransform point/direction test passed" << std::endl;
+    } else {
+        std::cout << "AffineTransform point/direction test failed" << std::endl;
+    }
+
+    if (inverse && singular) {
+        std::cout << "AffineTransform inverse test passed" << std::endl;
+    } else {
+        std::cout << "AffineTransform inverse test failed" << std::endl;
+    }
+}
+
+void TestPropagation() {
+    std::cout << "Testing AffineTransform hierarchy propagation..." << std::endl;
+
+    std::vector<int> parents = { -1, 0, 1, 0, 3 };
+    std::vector<AffineTransform> locals = {
+        AffineTransform::Translation(Vector3(0.0f, 1.0f, 0.0f)),
+        AffineTransform::Rotation(Quaternion::FromAxisAngle(Vector3::UnitY, 0.5f)),
+        AffineTransform::Scaling(Vector3(2.0f, 2.0f, 2.0f)),
+        AffineTransform::Translation(Vector3(3.0f, 0.0f, -1.0f)),
+        AffineTransform::FromTRS(Vector3(0.0f, 0.0f, 2.0f), Quaternion::FromAxisAngle(Vector3::UnitX, -0.3f), Vector3(1.0f, 1.0f, 1.0f))
+    };
+    std::vector<AffineTransform> worlds(locals.size());
+    AffineTransform::Propagate(parents.data(), locals.data(), worlds.data(), locals.size());
+
+    bool passed = true;
+    for (size_t i = 0; i < locals.size(); ++i) {
+        Matrix4 expected = locals[i].ToMatrix4();
+        for (int parent = parents[i]; parent >= 0; parent = parents[parent]) {
+            expected = locals[parent].ToMatrix4() * expected;
+        }
+        passed &= MatricesMatch(worlds[i].ToMatrix4(), expected);
+    }
+
+    if (passed) {
+        std::cout << "AffineTransform propagation test passed" << std::endl;
+    } else {
+        std::cout << "AffineTransform propagation test failed" << std::endl;
+    }
+}
+
+int main() {
+    TestConversion();
+    TestTransformAndInverse();
+    TestPropagation();
+    return 0;
+}
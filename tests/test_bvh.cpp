@@ -0,0 +1,173 @@
+#include <algorithm>
+#include <cmath>
+#include <iostream>
+#include <numeric>
+#include <random>
+#include <vector>
+#include "../include/Geometry/BVH.h"
+
+using namespace Geometry;
+using namespace Math3D;
+
+RayHit BruteForceIntersect(const Mesh& mesh, const Ray& ray) {
+    RayHit hit;
+    for (size_t t = 0; t < mesh.GetTriangleCount(); ++t) {
+        Vector3 p0 = mesh.GetPosition(mesh.indices[t * 3]);
+        Vector3 edge1 = mesh.GetPosition(mesh.indices[t * 3 + 1]) - p0;
+        Vector3 edge2 = mesh.GetPosition(mesh.indices[t * 3 + 2]) - p0;
+        Vector3 p = ray.direction.Cross(edge2);
+        float determinant = edge1.Dot(p);
+        if (std::abs(determinant) < 1e-12f) {
+            continue;
+        }
+        Vector3 s = ray.origin - p0;
+        float u = s.Dot(p) / determinant;
+        Vector3 q = s.Cross(edge1);
+        float v = ray.direction.Dot(q) / determinant;
+        float distance = edge2.Dot(q) / determinant;
+        if (u >= 0.0f && v >= 0.0f && u + v <= 1.0f && distance >= ray.tMin && distance < ray.tMax &&
+            distance < hit.distance) {
+            hit.distance = distance;
+            hit.triangle = static_cast<uint32_t>(t);
+        }
+    }
+    return hit;
+}
+
+std::vector<Ray> RandomRays(size_t count, unsigned seed) {
+    std::mt19937 random(seed);
+    std::uniform_real_distribution<float> spread(-3.0f, 3.0f);
+    std::vector<Ray> rays;
+    for (size_t i = 0; i < count; ++i) {
+        Vector3 origin(spread(random), spread(random), spread(random));
+        Vector3 target(spread(random) * 0.4f, spread(random) * 0.4f, spread(random) * 0.4f);
+        rays.emplace_back(origin, (target - origin).Normalized());
+    }
+    return rays;
+}
+
+bool MatchesBruteForce(const BVH& bvh, const Mesh& mesh, const std::vector<Ray>& rays, size_t& hits) {
+    bool matches = true;
+    hits = 0;
+    for (const Ray& ray : rays) {
+        RayHit expected = BruteForceIntersect(mesh, ray);
+        RayHit hit;
+        bool found = bvh.Intersect(ray, hit);
+        matches &= found == expected.IsHit() && bvh.Occluded(ray) == expected.IsHit();
+        if (found && expected.IsHit()) {
+            hits++;
+            matches &= std::abs(hit.distance - expected.distance) < 1e-4f;
+            Vector3 p0 = mesh.GetPosition(mesh.indices[hit.triangle * 3]);
+            Vector3 p1 = mesh.GetPosition(mesh.indices[hit.triangle * 3 + 1]);
+            Vector3 p2 = mesh.GetPosition(mesh.indices[hit.triangle * 3 + 2]);
+            Vector3 point = p0 * (1.0f - hit.u - hit.v) + p1 * hit.u + p2 * hit.v;
+            matches &= (point - ray.At(hit.distance)).Length() < 1e-3f;
+        }
+    }
+    return matches;
+}
+
+bool IsWellFormed(const BVH& bvh, size_t triangleCount, size_t maxLeafTriangles) {
+    const std::vector<BVHNode>& nodes = bvh.GetNodes();
+    std::vector<uint32_t> referenced;
+    bool contained = true;
+    for (const BVHNode& node : nodes) {
+        if (node.IsLeaf()) {
+            for (uint32_t i = node.leftFirst; i < node.leftFirst + node.triangleCount; ++i) {
+                referenced.push_back(bvh.GetTriangleIndices()[i]);
+            }
+            continue;
+        }
+        for (uint32_t child = node.leftFirst; child < node.leftFirst + 2; ++child) {
+            for (int a = 0; a < 3; ++a) {
+                contained &= nodes[child].boundsMin[a] >= node.boundsMin[a] &&
+                             nodes[child].boundsMax[a] <= node.boundsMax[a];
+            }
+        }
+    }
+    std::sort(referenced.begin(), referenced.end());
+    std::vector<uint32_t> expected(triangleCount);
+    std::iota(expected.begin(), expected.end(), 0u);
+
+    const BVHStatistics& statistics = bvh.GetStatistics();
+    return contained && referenced == expected && statistics.nodeCount == nodes.size() &&
+           statistics.leafCount * 2 == statistics.nodeCount + 1 && statistics.nodeMemory == nodes.size() * 32 &&
+           statistics.maxLeafTriangles <= maxLeafTriangles && statistics.maxDepth < BVH::MAX_DEPTH &&
+           statistics.sahCost > 0.0f && statistics.buildMilliseconds >= 0.0;
+}
+
+void TestBVHQueries() {
+    std::cout << "Testing BVH ray queries..." << std::endl;
+
+    Mesh sphere = Mesh::CreateSphere(1.5f, 24);
+    sphere.UpdateBounds();
+    BVH bvh = BVH::Build(sphere);
+
+    size_t hits = 0;
+    bool matches = MatchesBruteForce(bvh, sphere, RandomRays(500, 7), hits);
+
+    Ray inside(Vector3::Zero, Vector3(0.3f, 0.8f, -0.5f).Normalized());
+    RayHit insideHit;
+    bool fromInside = bvh.Intersect(inside, insideHit) && std::abs(insideHit.distance - 1.5f) < 0.05f;
+
+    Ray shadow(Vector3(0, 0, 5), Vector3(0, 0, -1), 0.0f, 2.0f);
+    bool shortRay = !bvh.Occluded(shadow) && bvh.Occluded(Ray(Vector3(0, 0, 5), Vector3(0, 0, -1)));
+
+    BoundingBox bounds = bvh.GetBounds();
+    bool boundsMatch = (bounds.min - sphere.bounds.min).Length() < 1e-5f &&
+                       (bounds.max - sphere.bounds.max).Length() < 1e-5f;
+
+    if (matches && hits > 100 && fromInside && shortRay && boundsMatch) {
+        std::cout << "BVH ray query test passed" << std::endl;
+    } else {
+        std::cout << "BVH ray query test failed" << std::endl;
+    }
+}
+
+void TestBVHStructure() {
+    std::cout << "Testing BVH structure..." << std::endl;
+
+    Mesh sphere = Mesh::CreateSphere(1.5f, 32);
+    BVH bvh = BVH::Build(sphere);
+    BVH wide = BVH::Build(sphere, 8);
+
+    Mesh invalid = Mesh::CreateCube(1.0f);
+    invalid.indices[0] = 1000;
+    RayHit emptyHit;
+
+    if (IsWellFormed(bvh, sphere.GetTriangleCount(), 4) && IsWellFormed(wide, sphere.GetTriangleCount(), 8) &&
+        wide.GetStatistics().nodeCount < bvh.GetStatistics().nodeCount && BVH::Build(Mesh()).Empty() &&
+        BVH::Build(invalid).Empty() && !BVH().Intersect(Ray(Vector3::Zero, Vector3::UnitZ), emptyHit)) {
+        std::cout << "BVH structure test passed" << std::endl;
+    } else {
+        std::cout << "BVH structure test failed" << std::endl;
+    }
+}
+
+void TestLargeBVH() {
+    std::cout << "Testing large BVH build..." << std::endl;
+
+    Mesh sphere = Mesh::CreateSphere(1.5f, 256);
+    BVH bvh = BVH::Build(sphere);
+    const BVHStatistics& statistics = bvh.GetStatistics();
+
+    size_t hits = 0;
+    bool matches = MatchesBruteForce(bvh, sphere, RandomRays(40, 11), hits);
+
+    std::cout << "  " << sphere.GetTriangleCount() << " triangles: " << statistics.buildMilliseconds << " ms, "
+              << statistics.nodeCount << " nodes, depth " << statistics.maxDepth << ", "
+              << statistics.GetTotalMemory() / 1024 << " KiB, SAH " << statistics.sahCost << std::endl;
+
+    if (matches && hits > 0 && IsWellFormed(bvh, sphere.GetTriangleCount(), 4)) {
+        std::cout << "Large BVH test passed" << std::endl;
+    } else {
+        std::cout << "Large BVH test failed" << std::endl;
+    }
+}
+
+int main() {
+    TestBVHQueries();
+    TestBVHStructure();
+    TestLargeBVH();
+    return 0;
+}
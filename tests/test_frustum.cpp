@@ -0,0 +1,118 @@
+#include <cmath>
+#include <iostream>
+#include <vector>
+#include "../include/Geometry/Frustum.h"
+#include "../include/Math3D/MathUtils.h"
+#include "../include/Math3D/SIMD.h"
+
+using namespace Geometry;
+using namespace Math3D;
+
+Matrix4 MakeViewProjection() {
+    Matrix4 projection = Matrix4::Perspective(MathUtils::Radians(60.0f), 4.0f / 3.0f, 0.5f, 50.0f);
+    Matrix4 view = Matrix4::LookAt(Vector3(0, 2, 10), Vector3::Zero, Vector3::UnitY);
+    return projection * view;
+}
+
+bool InClipSpace(const Matrix4& viewProjection, const Vector3& point) {
+    Vector4 clip = viewProjection * Vector4(point, 1.0f);
+    return clip.w > 0.0f &&
+           std::fabs(clip.x) <= clip.w && std::fabs(clip.y) <= clip.w && std::fabs(clip.z) <= clip.w;
+}
+
+void TestPlaneExtraction() {
+    std::cout << "Testing Frustum plane extraction..." << std::endl;
+
+    Matrix4 viewProjection = MakeViewProjection();
+    Frustum frustum(viewProjection);
+
+    bool normalized = true;
+    for (int p = 0; p < Frustum::PLANE_COUNT; ++p) {
+        normalized &= MathUtils::Approximately(frustum.GetPlane(static_cast<FrustumPlane>(p)).XYZ().Length(), 1.0f, 1e-5f);
+    }
+
+    bool agrees = true;
+    for (int i = 0; i < 200; ++i) {
+        float s = static_cast<float>(i);
+        Vector3 point(std::sin(s * 1.7f) * 20.0f, std::cos(s * 0.9f) * 15.0f, std::sin(s * 0.31f) * 60.0f - 20.0f);
+        agrees &= frustum.ContainsPoint(point) == InClipSpace(viewProjection, point);
+    }
+
+    Vector4 nearPlane = frustum.GetPlane(FrustumPlane::Near);
+    bool facing = nearPlane.XYZ().Dot(Vector3(0, -2, -10).Normalized()) > 0.99f;
+
+    if (normalized && agrees && facing) {
+        std::cout << "Plane extraction test passed" << std::endl;
+    } else {
+        std::cout << "Plane extraction test failed" << std::endl;
+    }
+}
+
+void TestBoundsIntersection() {
+    std::cout << "Testing Frustum bounds intersection..." << std::endl;
+
+    Frustum frustum(MakeViewProjection());
+
+    bool boxes = frustum.IntersectsBox(BoundingBox(Vector3(-1, -1, -1), Vector3(1, 1, 1))) &&
+                 frustum.IntersectsBox(BoundingBox(Vector3(-100, -1, -1), Vector3(100, 1, 1))) &&
+                 !frustum.IntersectsBox(BoundingBox(Vector3(-1, -1, 20), Vector3(1, 1, 22))) &&
+                 !frustum.IntersectsBox(BoundingBox(Vector3(30, -1, -1), Vector3(32, 1, 1)));
+    bool spheres = frustum.IntersectsSphere(Vector3::Zero, 0.5f) &&
+                   !frustum.IntersectsSphere(Vector3(0, 0, 12), 1.0f) &&
+                   frustum.IntersectsSphere(Vector3(0, 0, 12), 3.0f);
+
+    if (boxes && spheres) {
+        std::cout << "Bounds intersection test passed" << std::endl;
+    } else {
+        std::cout << "Bounds intersection test failed" << std::endl;
+    }
+}
+
+void TestBatchCulling() {
+    std::cout << "Testing Frustum batch culling (" << SIMD::GetLevelName(SIMD::GetLevel()) << ")..." << std::endl;
+
+    Frustum frustum(MakeViewProjection());
+
+    const size_t count = 77;
+    std::vector<BoundingBox> boxes(count);
+    std::vector<Vector3> centers(count);
+    std::vector<float> radii(count);
+    for (size_t i = 0; i < count; ++i) {
+        float s = static_cast<float>(i);
+        centers[i] = Vector3(std::sin(s * 2.3f) * 25.0f, std::cos(s * 1.1f) * 12.0f, std::sin(s * 0.7f) * 40.0f - 15.0f);
+        radii[i] = 0.5f + std::fmod(s * 0.37f, 3.0f);
+        Vector3 extent(radii[i], radii[i] * 0.5f, radii[i] * 2.0f);
+        boxes[i] = BoundingBox(centers[i] - extent, centers[i] + extent);
+    }
+
+    std::vector<uint32_t> boxMask(Frustum::GetMaskWordCount(count), 0xFFFFFFFFu);
+    std::vector<uint32_t> sphereMask(Frustum::GetMaskWordCount(count), 0xFFFFFFFFu);
+    size_t boxVisible = frustum.CullBoxes(boxes.data(), count, boxMask.data());
+    size_t sphereVisible = frustum.CullSpheres(centers.data(), radii.data(), count, sphereMask.data());
+
+    bool matches = true;
+    size_t expectedBoxes = 0, expectedSpheres = 0;
+    for (size_t i = 0; i < count; ++i) {
+        bool box = frustum.IntersectsBox(boxes[i]);
+        bool sphere = frustum.IntersectsSphere(centers[i], radii[i]);
+        expectedBoxes += box ? 1 : 0;
+        expectedSpheres += sphere ? 1 : 0;
+        matches &= Frustum::IsVisible(boxMask.data(), i) == box;
+        matches &= Frustum::IsVisible(sphereMask.data(), i) == sphere;
+    }
+    bool padding = (boxMask.back() >> (count % 32)) == 0 && (sphereMask.back() >> (count % 32)) == 0;
+    bool mixed = expectedBoxes > 0 && expectedBoxes < count && expectedSpheres > 0 && expectedSpheres < count;
+
+    if (matches && padding && mixed && boxVisible == expectedBoxes && sphereVisible == expectedSpheres) {
+        std::cout << "Batch culling test passed" << std::endl;
+    } else {
+        std::cout << "Batch culling test failed" << std::endl;
+    }
+}
+
+int main() {
+    TestPlaneExtraction();
+    TestBoundsIntersection();
+    TestBatchCulling();
+    return 0;
+}
@@ -0,0 +1,119 @@
+#include <cmath>
+#include <iostream>
+#include "../include/Geometry/LODGroup.h"
+#include "../include/Math3D/MathUtils.h"
+
+using namespace Geometry;
+using namespace Math3D;
+
+Matrix4 CameraAt(float distance) {
+    return Matrix4::LookAt(Vector3(0, 0, distance), Vector3::Zero, Vector3::UnitY);
+}
+
+void TestLevelConstruction() {
+    std::cout << "Testing LOD group construction..." << std::endl;
+
+    Mesh sphere = Mesh::CreateSphere(1.0f, 32);
+    LODGroup group = LODGroup::Create(sphere, { 0.1f, 0.5f, 0.25f });
+
+    bool ordered = group.GetLevelCount() == 4 && group.GetLevel(0).error == 0.0f &&
+                   group.GetLevel(0).mesh.GetTriangleCount() == sphere.GetTriangleCount();
+    for (size_t i = 1; i < group.GetLevelCount() && ordered; ++i) {
+        ordered &= group.GetLevel(i).error >= group.GetLevel(i - 1).error &&
+                   group.GetLevel(i).mesh.GetTriangleCount() < group.GetLevel(i - 1).mesh.GetTriangleCount();
+    }
+
+    LODGroup manual;
+    manual.AddLevel(Mesh::CreateSphere(1.0f, 8), 0.05f);
+    manual.AddLevel(sphere, 0.0f);
+    bool inserted = manual.GetLevelCount() == 2 &&
+                    manual.GetLevel(0).mesh.GetTriangleCount() == sphere.GetTriangleCount() &&
+                    manual.GetLevel(0).ratio == 1.0f && manual.GetLevel(1).ratio < 1.0f;
+
+    LODGroup cleared = group;
+    cleared.Clear();
+    bool empty = LODGroup().GetCurrentMesh().mesh.GetTriangleCount() == 0 && !LODGroup().GetBounds().IsValid() &&
+                 cleared.Empty() && cleared.GetCurrentMesh().mesh.GetTriangleCount() == 0 &&
+                 !cleared.GetBounds().IsValid();
+
+    if (ordered && inserted && empty) {
+        std::cout << "LOD group construction test passed" << std::endl;
+    } else {
+        std::cout << "LOD group construction test failed" << std::endl;
+    }
+}
+
+void TestScreenSpaceError() {
+    std::cout << "Testing screen-space error..." << std::endl;
+
+    LODGroup group;
+    group.AddLevel(Mesh::CreateSphere(1.0f, 16), 0.0f);
+    group.AddLevel(Mesh::CreateSphere(1.0f, 8), 0.01f);
+
+    Matrix4 projection = Matrix4::Perspective(MathUtils::Radians(90.0f), 1.0f, 0.1f, 100.0f);
+    float nearError = group.GetScreenSpaceError(1, projection, CameraAt(3.0f), 600.0f);
+    float farError = group.GetScreenSpaceError(1, projection, CameraAt(23.0f), 600.0f);
+    float scaledError = group.GetScreenSpaceError(1, projection, CameraAt(23.0f) * Matrix4::Scaling(Vector3(2, 2, 2)),
+                                                  600.0f);
+
+    Matrix4 orthographic = Matrix4::Orthographic(-10.0f, 10.0f, -10.0f, 10.0f, 0.1f, 100.0f);
+    float orthoNear = group.GetScreenSpaceError(1, orthographic, CameraAt(3.0f), 600.0f);
+    float orthoFar = group.GetScreenSpaceError(1, orthographic, CameraAt(50.0f), 600.0f);
+
+    const float radius = std::sqrt(3.0f);
+    bool perspective = MathUtils::Approximately(nearError, 0.01f * 300.0f / (3.0f - radius), 1e-3f) &&
+                       MathUtils::Approximately(nearError / farError, (23.0f - radius) / (3.0f - radius), 1e-3f) &&
+                       scaledError > farError * 2.0f;
+    bool orthographicConstant = MathUtils::Approximately(orthoNear, orthoFar, 1e-5f) &&
+                                MathUtils::Approximately(orthoNear, 0.01f * 0.1f * 300.0f, 1e-5f);
+    bool inside = group.SelectLevel(projection, CameraAt(0.5f), 600.0f) == 0;
+    bool unknownProjection = group.SelectLevel(projection, CameraAt(1000.0f), 600.0f) == 1 &&
+                             group.SelectLevel(Matrix4(), CameraAt(1000.0f), 600.0f) == 0;
+
+    if (perspective && orthographicConstant && inside && unknownProjection) {
+        std::cout << "Screen-space error test passed" << std::endl;
+    } else {
+        std::cout << "Screen-space error test failed" << std::endl;
+    }
+}
+
+void TestHysteresis() {
+    std::cout << "Testing LOD hysteresis..." << std::endl;
+
+    LODGroup group;
+    group.AddLevel(Mesh::CreateSphere(1.0f, 32), 0.0f);
+    group.AddLevel(Mesh::CreateSphere(1.0f, 16), 0.01f);
+    group.AddLevel(Mesh::CreateSphere(1.0f, 8), 0.04f);
+    group.SetErrorThreshold(1.0f);
+    group.SetHysteresis(0.25f);
+
+    Matrix4 projection = Matrix4::Perspective(MathUtils::Radians(90.0f), 1.0f, 0.1f, 100.0f);
+    auto distanceFor = [&](float error, float pixels) {
+        return error * 300.0f / pixels + std::sqrt(3.0f);
+    };
+
+    size_t close = group.SelectLevel(projection, CameraAt(2.0f), 600.0f);
+    size_t atThreshold = group.SelectLevel(projection, CameraAt(distanceFor(0.01f, 0.9f)), 600.0f);
+    size_t pastBand = group.SelectLevel(projection, CameraAt(distanceFor(0.01f, 0.7f)), 600.0f);
+    size_t withinBand = group.SelectLevel(projection, CameraAt(distanceFor(0.01f, 0.9f)), 600.0f);
+    size_t backOverThreshold = group.SelectLevel(projection, CameraAt(distanceFor(0.01f, 1.1f)), 600.0f);
+    size_t far = group.SelectLevel(projection, CameraAt(1000.0f), 600.0f);
+
+    group.SetHysteresis(0.0f);
+    group.ResetSelection();
+    size_t immediate = group.SelectLevel(projection, CameraAt(distanceFor(0.01f, 0.9f)), 600.0f);
+
+    if (close == 0 && atThreshold == 0 && pastBand == 1 && withinBand == 1 && backOverThreshold == 0 && far == 2 &&
+        immediate == 1 && group.GetCurrentLevel() == 1) {
+        std::cout << "LOD hysteresis test passed" << std::endl;
+    } else {
+        std::cout << "LOD hysteresis test failed" << std::endl;
+    }
+}
+
+int main() {
+    TestLevelConstruction();
+    TestScreenSpaceError();
+    TestHysteresis();
+    return 0;
+}
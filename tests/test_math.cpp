@@ -1,6 +1,10 @@
+#include <cmath>
 #include <iostream>
+#include <vector>
 #include "Math3D/Vector3.h"
 #include "Math3D/MathUtils.h"
+#include "Math3D/Matrix4.h"
+#include "Math3D/SIMD.h"
 
 using namespace Math3D;
 
@@ -47,7 +51,65 @@ void TestVector3() {
     }
 }
 
+void TestConstexpr() {
+    std::cout << "Testing constexpr math..." << std::endl;
+
+    constexpr Vector3 axis = Vector3::UnitX.Cross(Vector3::UnitY);
+    static_assert(axis == Vector3::UnitZ, "Cross product must fold at compile time");
+
+    constexpr Matrix4 model = Matrix4::Translation(Vector3(1.0f, 2.0f, 3.0f)) + Matrix4::Scaling(Vector3::One) - Matrix4::Identity();
+    static_assert(model(0, 3) == 1.0f && model(2, 3) == 3.0f && model(1, 1) == 1.0f, "Translation must fold at compile time");
+    static_assert(model.IsAffine() && model.Determinant() == 1.0f, "Determinant must fold at compile time");
+
+    constexpr Matrix4 ortho = Matrix4::Orthographic(-2.0f, 2.0f, -1.0f, 1.0f, 0.0f, 10.0f);
+    static_assert(ortho(0, 0) == 0.5f && ortho.Transposed()(3, 2) == ortho(2, 3), "Orthographic must fold at compile time");
+
+    static_assert(MathUtils::Approximately(MathUtils::Radians(180.0f), MathUtils::PI), "Radians must fold at compile time");
+
+    std::cout << "Constexpr math test passed" << std::endl;
+}
+
+void TestSinCos() {
+    std::cout << "Testing batched sincos (" << SIMD::GetLevelName(SIMD::GetLevel()) << ")..." << std::endl;
+
+    const size_t count = 1003;
+    std::vector<float> angles(count), sines(count), cosines(count);
+    for (size_t i = 0; i < count; ++i) {
+        angles[i] = (static_cast<float>(i) - 500.0f) * 0.731f;
+    }
+    angles[7] = 0.0f;
+    angles[8] = MathUtils::PI * 0.25f;
+    angles[9] = 20000.0f;
+    MathUtils::SinCosBatch(angles.data(), sines.data(), cosines.data(), count);
+
+    bool accurate = true, consistent = true;
+    for (size_t i = 0; i < count; ++i) {
+        double angle = angles[i];
+        accurate &= std::fabs(sines[i] - std::sin(angle)) <= MathUtils::SINCOS_MAX_ERROR &&
+                    std::fabs(cosines[i] - std::cos(angle)) <= MathUtils::SINCOS_MAX_ERROR;
+        float sine, cosine;
+        MathUtils::SinCos(angles[i], sine, cosine);
+        consistent &= sine == sines[i] && cosine == cosines[i];
+    }
+
+    std::vector<float> ringSin(37), ringCos(37);
+    MathUtils::SinCosRing(0.5f, 0.25f, ringSin.size(), ringSin.data(), ringCos.data());
+    bool ring = true;
+    for (size_t i = 0; i < ringSin.size(); ++i) {
+        ring &= MathUtils::Approximately(ringSin[i], std::sin(0.5f + static_cast<float>(i) * 0.25f), 1e-6f) &&
+                MathUtils::Approximately(ringCos[i], std::cos(0.5f + static_cast<float>(i) * 0.25f), 1e-6f);
+    }
+
+    if (accurate && consistent && ring) {
+        std::cout << "SinCos batch test passed" << std::endl;
+    } else {
+        std::cout << "SinCos batch test failed" << std::endl;
+    }
+}
+
 int main() {
     TestVector3();
+    TestConstexpr();
+    TestSinCos();
     return 0;
 }
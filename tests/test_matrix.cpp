@@ -1,6 +1,10 @@
+#include <cmath>
 #include <iostream>
+#include <vector>
 #include "../include/Math3D/Matrix4.h"
 #include "../include/Math3D/MathUtils.h"
+#include "../include/Math3D/Quaternion.h"
+#include "../include/Math3D/SIMD.h"
 
 using namespace Math3D;
 
@@ -42,9 +46,171 @@ void TestMatrix4() {
     } else {
         std::cout << "Vector transformation test failed" << std::endl;
     }
+
+    Matrix4 lhs = Matrix4::Perspective(MathUtils::Radians(60.0f), 1.5f, 0.1f, 50.0f) *
+                  Matrix4::LookAt(Vector3(3.0f, 2.0f, 5.0f), Vector3(0.0f, 0.0f, 0.0f), Vector3(0.0f, 1.0f, 0.0f));
+    Matrix4 rhs = Matrix4::Translation(Vector3(-1.0f, 0.5f, 2.0f)) * Matrix4::RotationZ(0.7f) *
+                  Matrix4::Scaling(Vector3(1.5f, 0.5f, 2.0f));
+    Matrix4 product = lhs * rhs;
+
+    bool productMatches = true;
+    for (int row = 0; row < 4; ++row) {
+        for (int col = 0; col < 4; ++col) {
+            float expected = 0.0f;
+            for (int k = 0; k < 4; ++k) {
+                expected += lhs(row, k) * rhs(k, col);
+            }
+            if (!MathUtils::Approximately(product(row, col), expected, 1e-5f)) {
+                productMatches = false;
+            }
+        }
+    }
+
+    Vector4 point(0.25f, -1.5f, 3.0f, 1.0f);
+    Vector4 chained = lhs * (rhs * point);
+    Vector4 combined = product * point;
+    bool vectorMatches = MathUtils::Approximately(chained.x, combined.x, 1e-4f) &&
+                         MathUtils::Approximately(chained.y, combined.y, 1e-4f) &&
+                         MathUtils::Approximately(chained.z, combined.z, 1e-4f) &&
+                         MathUtils::Approximately(chained.w, combined.w, 1e-4f);
+
+    if (productMatches && vectorMatches) {
+        std::cout << "SIMD multiplication test passed (" << SIMD::GetLevelName(SIMD::GetLevel()) << ")" << std::endl;
+    } else {
+        std::cout << "SIMD multiplication test failed (" << SIMD::GetLevelName(SIMD::GetLevel()) << ")" << std::endl;
+    }
+}
+
+bool Matches(const Vector3& a, const Vector3& b) {
+    return MathUtils::Approximately(a.x, b.x, 1e-4f) &&
+           MathUtils::Approximately(a.y, b.y, 1e-4f) &&
+           MathUtils::Approximately(a.z, b.z, 1e-4f);
+}
+
+void TestBatchTransforms() {
+    std::cout << "Testing batch transforms..." << std::endl;
+
+    const size_t count = 37;
+    std::vector<Vector3> points(count);
+    for (size_t i = 0; i < count; ++i) {
+        float t = static_cast<float>(i);
+        points[i] = Vector3(std::sin(t) * 3.0f, std::cos(t * 0.7f) * 2.0f, t * 0.1f - 1.0f);
+    }
+
+    Matrix4 model = Matrix4::Translation(Vector3(1.0f, -2.0f, 0.5f)) * Matrix4::RotationY(0.4f) *
+                    Matrix4::Scaling(Vector3(2.0f, 1.0f, 0.5f));
+    Matrix4 projection = Matrix4::Perspective(MathUtils::Radians(60.0f), 1.0f, 0.1f, 100.0f) *
+                         Matrix4::Translation(Vector3(0.0f, 0.0f, -10.0f));
+
+    std::vector<Vector3> transformed(count), directions(count), projected(count);
+    model.TransformPoints(points.data(), transformed.data(), count);
+    model.TransformDirections(points.data(), directions.data(), count);
+    projection.TransformPointsProjective(points.data(), projected.data(), count);
+
+    bool pointsMatch = true, directionsMatch = true, projectedMatch = true;
+    for (size_t i = 0; i < count; ++i) {
+        pointsMatch &= Matches(transformed[i], (model * Vector4(points[i], 1.0f)).XYZ());
+        directionsMatch &= Matches(directions[i], (model * Vector4(points[i], 0.0f)).XYZ());
+        Vector4 clip = projection * Vector4(points[i], 1.0f);
+        projectedMatch &= Matches(projected[i], clip.XYZ() / clip.w);
+    }
+
+    std::vector<Vector3> inPlace = points;
+    model.TransformPoints(inPlace.data(), inPlace.data(), count);
+    bool inPlaceMatches = true;
+    for (size_t i = 0; i < count; ++i) {
+        inPlaceMatches &= Matches(inPlace[i], transformed[i]);
+    }
+
+    if (pointsMatch && directionsMatch && projectedMatch && inPlaceMatches) {
+        std::cout << "Batch transform test passed" << std::endl;
+    } else {
+        std::cout << "Batch transform test failed" << std::endl;
+    }
+}
+
+bool MatricesMatch(const Matrix4& a, const Matrix4& b) {
+    for (int row = 0; row < 4; ++row) {
+        for (int col = 0; col < 4; ++col) {
+            if (!MathUtils::Approximately(a(row, col), b(row, col), 1e-5f)) {
+                return false;
+            }
+        }
+    }
+    return true;
+}
+
+void TestFromTRS() {
+    std::cout << "Testing fused TRS construction..." << std::endl;
+
+    const size_t count = 300;
+    std::vector<Vector3> translations(count), angles(count), scales(count);
+    std::vector<Quaternion> rotations(count);
+    for (size_t i = 0; i < count; ++i) {
+        float t = static_cast<float>(i);
+        translations[i] = Vector3(t * 0.1f, std::sin(t), -t * 0.05f);
+        angles[i] = Vector3(std::sin(t * 0.3f) * 2.0f, t * 0.07f, std::cos(t) * 1.5f);
+        scales[i] = Vector3(1.0f + std::fmod(t * 0.13f, 2.0f), 0.5f, 2.0f - std::fmod(t * 0.07f, 1.0f));
+        rotations[i] = Quaternion::FromEuler(angles[i].x, angles[i].y, angles[i].z);
+    }
+
+    std::vector<Matrix4> eulerBatch(count), quaternionBatch(count);
+    Matrix4::FromTRSBatch(translations.data(), angles.data(), scales.data(), eulerBatch.data(), count);
+    Matrix4::FromTRSBatch(translations.data(), rotations.data(), scales.data(), quaternionBatch.data(), count);
+
+    bool single = true, batch = true;
+    for (size_t i = 0; i < count; ++i) {
+        Matrix4 expected = Matrix4::Translation(translations[i]) *
+                           Matrix4::RotationY(angles[i].y) * Matrix4::RotationX(angles[i].x) * Matrix4::RotationZ(angles[i].z) *
+                           Matrix4::Scaling(scales[i]);
+        Matrix4 euler = Matrix4::FromTRS(translations[i], angles[i], scales[i]);
+        single &= MatricesMatch(euler, expected);
+        single &= MatricesMatch(Matrix4::FromTRS(translations[i], rotations[i], scales[i]), expected);
+        batch &= euler == eulerBatch[i] && MatricesMatch(quaternionBatch[i], expected);
+    }
+
+    if (single && batch) {
+        std::cout << "FromTRS test passed" << std::endl;
+    } else {
+        std::cout << "FromTRS test failed" << std::endl;
+    }
+}
+
+void TestNormalMatrix() {
+    std::cout << "Testing normal matrix..." << std::endl;
+
+    Matrix4 model = Matrix4::FromTRS(Vector3(3.0f, -1.0f, 2.0f), Vector3(0.4f, -0.9f, 0.2f), Vector3(4.0f, 0.5f, 1.5f));
+    Matrix3 normalMatrix = model.NormalMatrix();
+    Matrix4 reference = model.Inverted().Transposed();
+
+    bool matchesInverse = true;
+    for (int row = 0; row < 3; ++row) {
+        for (int col = 0; col < 3; ++col) {
+            matchesInverse &= MathUtils::Approximately(normalMatrix(row, col), reference(row, col), 1e-5f);
+        }
+    }
+
+    Vector3 edgeA(1.0f, 2.0f, -0.5f), edgeB(-0.3f, 0.7f, 1.1f);
+    Vector3 normal = edgeA.Cross(edgeB);
+    Matrix3 linear = model.GetUpper3x3();
+    Vector3 transformedNormal = normalMatrix * normal;
+    bool perpendicular = MathUtils::Approximately(transformedNormal.Dot(linear * edgeA), 0.0f, 1e-4f) &&
+                         MathUtils::Approximately(transformedNormal.Dot(linear * edgeB), 0.0f, 1e-4f);
+
+    Matrix3 mirrored = Matrix4::Scaling(Vector3(-2.0f, 1.0f, 1.0f)).NormalMatrix();
+    bool orientation = (mirrored * Vector3::UnitX).x < 0.0f && (mirrored * Vector3::UnitY).y > 0.0f;
+
+    if (matchesInverse && perpendicular && orientation) {
+        std::cout << "Normal matrix test passed" << std::endl;
+    } else {
+        std::cout << "Normal matrix test failed" << std::endl;
+    }
 }
 
 int main() {
     TestMatrix4();
+    TestBatchTransforms();
+    TestFromTRS();
+    TestNormalMatrix();
     return 0;
 }
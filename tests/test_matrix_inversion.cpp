@@ -1,7 +1,10 @@
 #include <iostream>
 #include <chrono>
+#include <cmath>
+#include <vector>
 #include "../include/Math3D/Matrix4.h"
 #include "../include/Math3D/MathUtils.h"
+#include "../include/Math3D/SIMD.h"
 
 using namespace Math3D;
 using namespace std::chrono;
@@ -34,7 +37,102 @@ void TestInversion() {
     std::cout << "Performance ratio: " << (float)fullTime.count() / optimizedTime.count() << "x" << std::endl;
 }
 
+bool IsIdentity(const Matrix4& matrix) {
+    Matrix4 identity = Matrix4::Identity();
+    for (int row = 0; row < 4; ++row) {
+        for (int col = 0; col < 4; ++col) {
+            if (!MathUtils::Approximately(matrix(row, col), identity(row, col), 1e-4f)) {
+                return false;
+            }
+        }
+    }
+    return true;
+}
+
+void TestInversionAccuracy() {
+    std::cout << "Testing Matrix Inversion accuracy..." << std::endl;
+
+    Matrix4 affine = Matrix4::Translation(Vector3(1, 2, 3)) *
+                    Matrix4::RotationY(MathUtils::Radians(45)) *
+                    Matrix4::Scaling(Vector3(2, 0.5f, 3));
+
+    if (IsIdentity(affine * affine.FastInvertAffine()) && IsIdentity(affine.Inverted() * affine)) {
+        std::cout << "Scaled affine inversion test passed" << std::endl;
+    } else {
+        std::cout << "Scaled affine inversion test failed" << std::endl;
+    }
+
+    Matrix4 projective = Matrix4::Perspective(MathUtils::Radians(70), 16.0f / 9.0f, 0.1f, 100.0f) *
+                         Matrix4::LookAt(Vector3(4, 3, 6), Vector3(0, 1, 0), Vector3(0, 1, 0));
+
+    if (IsIdentity(projective * projective.Inverted())) {
+        std::cout << "Projective inversion test passed" << std::endl;
+    } else {
+        std::cout << "Projective inversion test failed" << std::endl;
+    }
+
+    Matrix4 singular = Matrix4::Scaling(Vector3(1, 0, 1));
+    Matrix4 singularProjective = Matrix4::Perspective(MathUtils::Radians(60), 1.0f, 1.0f, 10.0f);
+    singularProjective(3, 2) = 0.0f;
+
+    if (singular.Inverted() == Matrix4::Identity() && singularProjective.Inverted() == Matrix4::Identity()) {
+        std::cout << "Singular inversion test passed" << std::endl;
+    } else {
+        std::cout << "Singular inversion test failed" << std::endl;
+    }
+}
+
+void TestBatchInversion() {
+    std::cout << "Testing batch inversion (" << SIMD::GetLevelName(SIMD::GetLevel()) << ")..." << std::endl;
+
+    const size_t count = 29;
+    std::vector<Matrix4> matrices(count);
+    for (size_t i = 0; i < count; ++i) {
+        float t = static_cast<float>(i);
+        matrices[i] = Matrix4::FromTRS(Vector3(t, std::sin(t) * 4.0f, -t * 0.5f),
+                                       Vector3(t * 0.3f, std::cos(t), t * 0.11f),
+                                       Vector3(1.0f + t * 0.1f, 0.5f, 2.0f));
+    }
+    for (size_t i = 0; i < count; i += 3) {
+        matrices[i] = Matrix4::Perspective(MathUtils::Radians(50.0f + static_cast<float>(i)), 1.5f, 0.1f, 100.0f) * matrices[i];
+    }
+    matrices[2] = Matrix4::Scaling(Vector3(1.0f, 0.0f, 1.0f));
+    matrices[13] = Matrix4();
+    matrices[20](3, 0) = std::nanf("");
+
+    std::vector<Matrix4> inverses(count);
+    Matrix4::InvertBatch(matrices.data(), inverses.data(), count);
+
+    bool matches = true;
+    for (size_t i = 0; i < count; ++i) {
+        Matrix4 expected = matrices[i].Inverted();
+        for (int row = 0; row < 4; ++row) {
+            for (int col = 0; col < 4; ++col) {
+                float tolerance = 1e-4f * std::fmax(1.0f, std::fabs(expected(row, col)));
+                bool bothNaN = std::isnan(inverses[i](row, col)) && std::isnan(expected(row, col));
+                matches &= bothNaN || std::fabs(inverses[i](row, col) - expected(row, col)) <= tolerance;
+            }
+        }
+    }
+    bool singular = inverses[2] == Matrix4::Identity() && inverses[13] == Matrix4::Identity();
+
+    std::vector<Matrix4> inPlace = matrices;
+    Matrix4::InvertBatch(inPlace.data(), inPlace.data(), count);
+    bool aliasing = true;
+    for (size_t i = 0; i < count; ++i) {
+        aliasing &= i == 20 || inPlace[i] == inverses[i];
+    }
+
+    if (matches && singular && aliasing) {
+        std::cout << "Batch inversion test passed" << std::endl;
+    } else {
+        std::cout << "Batch inversion test failed" << std::endl;
+    }
+}
+
 int main() {
     TestInversion();
+    TestInversionAccuracy();
+    TestBatchInversion();
     return 0;
 }
@@ -155,6 +155,23 @@ void TestMeshTransformation() {
     } else {
         std::cout << "Mesh transformation test failed" << std::endl;
     }
+    
+    Mesh sphere = Mesh::CreateSphere(1.0f, 12);
+    Vector3 scale(2.0f, 1.0f, 0.5f);
+    sphere.Transform(Matrix4::Scaling(scale));
+    
+    bool normalsMatch = true;
+    for (const auto& vertex : sphere.vertices) {
+        const Vector3& p = vertex.position;
+        Vector3 expected = Vector3(p.x / (scale.x * scale.x), p.y / (scale.y * scale.y), p.z / (scale.z * scale.z)).Normalized();
+        normalsMatch &= vertex.normal.Dot(expected) > 0.9999f;
+    }
+    
+    if (normalsMatch) {
+        std::cout << "Non-uniform scale normal test passed" << std::endl;
+    } else {
+        std::cout << "Non-uniform scale normal test failed" << std::endl;
+    }
 }
 
 void TestBoundsCalculation() {
@@ -217,6 +234,57 @@ void TestPrimitiveTangentSpaces() {
     }
 }
 
+bool VerticesMatch(const Vertex& a, const Vertex& b, float tolerance) {
+    return (a.position - b.position).Length() <= tolerance &&
+           (a.normal - b.normal).Length() <= tolerance &&
+           (a.tangent - b.tangent).Length() <= tolerance &&
+           (a.bitangent - b.bitangent).Length() <= tolerance &&
+           (a.texCoord - b.texCoord).Length() <= tolerance;
+}
+
+void TestStreamLayout() {
+    std::cout << "Testing Stream Layout..." << std::endl;
+    
+    Mesh interleaved = Mesh::CreateSphere(1.5f, 10);
+    Mesh streamed = interleaved;
+    streamed.SetLayout(VertexLayout::Streams);
+    
+    bool converted = streamed.GetLayout() == VertexLayout::Streams &&
+                     streamed.vertices.empty() &&
+                     streamed.GetVertexCount() == interleaved.GetVertexCount() &&
+                     streamed.IsValid();
+    for (size_t i = 0; i < interleaved.GetVertexCount(); ++i) {
+        converted &= streamed.GetVertex(i) == interleaved.vertices[i];
+    }
+    
+    Matrix4 transform = Matrix4::Translation(Vector3(1.0f, -2.0f, 0.5f)) *
+                        Matrix4::RotationY(0.7f) *
+                        Matrix4::Scaling(Vector3(2.0f, 1.0f, 0.5f));
+    interleaved.Transform(transform);
+    streamed.Transform(transform);
+    interleaved.CalculateNormals();
+    streamed.CalculateNormals();
+    interleaved.CalculateTangents();
+    streamed.CalculateTangents();
+    
+    bool consistent = (streamed.bounds.min - interleaved.bounds.min).Length() < 1e-5f &&
+                      (streamed.bounds.max - interleaved.bounds.max).Length() < 1e-5f;
+    for (size_t i = 0; i < interleaved.GetVertexCount(); ++i) {
+        consistent &= VerticesMatch(streamed.GetVertex(i), interleaved.vertices[i], 1e-4f);
+    }
+    
+    streamed.SetLayout(VertexLayout::Interleaved);
+    bool restored = streamed.GetLayout() == VertexLayout::Interleaved &&
+                    streamed.streams.Empty() &&
+                    streamed.vertices.size() == interleaved.vertices.size();
+    
+    if (converted && consistent && restored) {
+        std::cout << "Stream layout test passed" << std::endl;
+    } else {
+        std::cout << "Stream layout test failed" << std::endl;
+    }
+}
+
 int main() {
     std::cout << "=== Running Mesh Tests ===" << std::endl;
     
@@ -228,6 +296,7 @@ int main() {
     TestMeshTransformation();
     TestBoundsCalculation();
     TestPrimitiveTangentSpaces();
+    TestStreamLayout();
     
     std::cout << "=== Mesh Tests Complete ===" << std::endl;
     return 0;
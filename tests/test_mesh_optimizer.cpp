@@ -0,0 +1,324 @@
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <iostream>
+#include <vector>
+#include "../include/Geometry/Mesh.h"
+
+using namespace Geometry;
+using namespace Math3D;
+
+std::vector<std::array<uint32_t, 3>> CanonicalTriangles(const std::vector<uint32_t>& indices) {
+    std::vector<std::array<uint32_t, 3>> triangles;
+    for (size_t i = 0; i + 2 < indices.size(); i += 3) {
+        std::array<uint32_t, 3> triangle = { indices[i], indices[i + 1], indices[i + 2] };
+        while (triangle[0] != std::min({ triangle[0], triangle[1], triangle[2] })) {
+            std::rotate(triangle.begin(), triangle.begin() + 1, triangle.end());
+        }
+        triangles.push_back(triangle);
+    }
+    std::sort(triangles.begin(), triangles.end());
+    return triangles;
+}
+
+void ShuffleTriangles(std::vector<uint32_t>& indices) {
+    uint32_t state = 12345u;
+    for (size_t t = indices.size() / 3; t > 1; --t) {
+        state = state * 1664525u + 1013904223u;
+        size_t other = state % t;
+        for (int k = 0; k < 3; ++k) {
+            std::swap(indices[(t - 1) * 3 + k], indices[other * 3 + k]);
+        }
+    }
+}
+
+void TestCacheAnalysis() {
+    std::cout << "Testing vertex cache analysis..." << std::endl;
+
+    Mesh strip;
+    for (int i = 0; i < 4; ++i) {
+        strip.vertices.push_back(Vertex(Vector3(static_cast<float>(i), 0.0f, 0.0f)));
+    }
+    strip.indices = { 0, 1, 2, 2, 1, 3 };
+
+    VertexCacheStatistics cached = strip.AnalyzeVertexCache(16);
+    VertexCacheStatistics uncached = strip.AnalyzeVertexCache(1);
+
+    if (cached.verticesTransformed == 4 && cached.acmr == 2.0f && cached.atvr == 1.0f &&
+        uncached.verticesTransformed == 5 && uncached.atvr == 1.25f &&
+        Mesh().AnalyzeVertexCache().acmr == 0.0f) {
+        std::cout << "Cache analysis test passed" << std::endl;
+    } else {
+        std::cout << "Cache analysis test failed" << std::endl;
+    }
+}
+
+void TestVertexCacheOptimization() {
+    std::cout << "Testing vertex cache optimization..." << std::endl;
+
+    Mesh grid = Mesh::CreatePlane(4.0f, 48);
+    ShuffleTriangles(grid.indices);
+    std::vector<uint32_t> shuffled = grid.indices;
+    VertexCacheStatistics before = grid.AnalyzeVertexCache();
+    grid.OptimizeVertexCache();
+    VertexCacheStatistics after = grid.AnalyzeVertexCache();
+
+    Mesh sphere = Mesh::CreateSphere(1.0f, 64);
+    VertexCacheStatistics sphereBefore = sphere.AnalyzeVertexCache();
+    std::vector<uint32_t> original = sphere.indices;
+    sphere.OptimizeVertexCache();
+    VertexCacheStatistics sphereAfter = sphere.AnalyzeVertexCache();
+
+    bool preserved = CanonicalTriangles(shuffled) == CanonicalTriangles(grid.indices) &&
+                     CanonicalTriangles(original) == CanonicalTriangles(sphere.indices);
+
+    Mesh invalid = Mesh::CreateCube(1.0f);
+    invalid.indices.insert(invalid.indices.end(), { 0, 1, 99 });
+    invalid.OptimizeVertexCache();
+    bool invalidKept = invalid.indices.size() == 39 && invalid.indices[38] == 99;
+
+    std::cout << "  Grid ACMR " << before.acmr << " -> " << after.acmr
+              << ", sphere ACMR " << sphereBefore.acmr << " -> " << sphereAfter.acmr << std::endl;
+
+    if (preserved && invalidKept && after.acmr < 0.8f && after.acmr < before.acmr * 0.4f &&
+        sphereAfter.acmr < sphereBefore.acmr && after.atvr < 1.5f) {
+        std::cout << "Vertex cache optimization test passed" << std::endl;
+    } else {
+        std::cout << "Vertex cache optimization test failed" << std::endl;
+    }
+}
+
+Mesh CreateSphereRow(int count) {
+    Mesh row;
+    for (int i = 0; i < count; ++i) {
+        Mesh sphere = Mesh::CreateSphere(1.0f, 24);
+        sphere.Transform(Matrix4::Translation(Vector3(static_cast<float>(i) * 1.5f, 0.0f, 0.0f)));
+        uint32_t base = static_cast<uint32_t>(row.vertices.size());
+        row.vertices.insert(row.vertices.end(), sphere.vertices.begin(), sphere.vertices.end());
+        for (uint32_t index : sphere.indices) {
+            row.indices.push_back(base + index);
+        }
+    }
+    row.UpdateBounds();
+    return row;
+}
+
+void TestOverdrawOptimization() {
+    std::cout << "Testing overdraw optimization..." << std::endl;
+
+    Mesh row = CreateSphereRow(4);
+    row.OptimizeVertexCache();
+    std::vector<uint32_t> original = row.indices;
+    OverdrawStatistics before = row.AnalyzeOverdraw();
+    VertexCacheStatistics cacheBefore = row.AnalyzeVertexCache();
+
+    row.OptimizeOverdraw();
+    OverdrawStatistics after = row.AnalyzeOverdraw();
+    VertexCacheStatistics cacheAfter = row.AnalyzeVertexCache();
+
+    std::cout << "  Overdraw " << before.overdraw << " -> " << after.overdraw
+              << ", ACMR " << cacheBefore.acmr << " -> " << cacheAfter.acmr << std::endl;
+
+    Mesh quad;
+    quad.vertices = { Vertex(Vector3(0, 0, 0)), Vertex(Vector3(1, 0, 0)), Vertex(Vector3(1, 1, 0)), Vertex(Vector3(0, 1, 0)) };
+    quad.indices = { 0, 1, 2, 0, 2, 3 };
+    OverdrawStatistics flat = quad.AnalyzeOverdraw();
+
+    bool preserved = CanonicalTriangles(original) == CanonicalTriangles(row.indices);
+    if (preserved && after.overdraw < before.overdraw && after.pixelsCovered == before.pixelsCovered &&
+        cacheAfter.acmr <= cacheBefore.acmr * Mesh::DEFAULT_OVERDRAW_THRESHOLD + 0.05f &&
+        flat.pixelsCovered > 0 && flat.overdraw == 1.0f) {
+        std::cout << "Overdraw optimization test passed" << std::endl;
+    } else {
+        std::cout << "Overdraw optimization test failed" << std::endl;
+    }
+}
+
+void TestVertexFetchOptimization() {
+    std::cout << "Testing vertex fetch optimization..." << std::endl;
+
+    Mesh sphere = Mesh::CreateSphere(1.0f, 16);
+    sphere.OptimizeVertexCache();
+
+    std::vector<Vector3> expected;
+    for (uint32_t index : sphere.indices) {
+        expected.push_back(sphere.vertices[index].position);
+    }
+    sphere.vertices.push_back(Vertex(Vector3(50.0f, 50.0f, 50.0f)));
+    size_t originalCount = sphere.GetVertexCount();
+
+    Mesh streamed = sphere;
+    streamed.SetLayout(VertexLayout::Streams);
+
+    size_t kept = sphere.OptimizeVertexFetch();
+    size_t streamedKept = streamed.OptimizeVertexFetch();
+
+    bool linear = true;
+    uint32_t nextNew = 0;
+    for (uint32_t index : sphere.indices) {
+        linear &= index <= nextNew;
+        if (index == nextNew) {
+            nextNew++;
+        }
+    }
+
+    bool preserved = true;
+    for (size_t i = 0; i < sphere.indices.size(); ++i) {
+        preserved &= sphere.vertices[sphere.indices[i]].position == expected[i];
+        preserved &= streamed.GetPosition(streamed.indices[i]) == expected[i];
+    }
+
+    if (linear && preserved && kept == originalCount - 1 && streamedKept == kept &&
+        sphere.GetVertexCount() == kept && sphere.bounds.max.x < 2.0f) {
+        std::cout << "Vertex fetch optimization test passed" << std::endl;
+    } else {
+        std::cout << "Vertex fetch optimization test failed" << std::endl;
+    }
+}
+
+void TestVertexWelding() {
+    std::cout << "Testing vertex welding..." << std::endl;
+
+    Mesh grid = Mesh::CreatePlane(2.0f, 8);
+    Mesh soup;
+    for (uint32_t index : grid.indices) {
+        Vertex vertex = grid.vertices[index];
+        vertex.position.y += (soup.vertices.size() % 2 == 0) ? 2e-6f : -2e-6f;
+        soup.vertices.push_back(vertex);
+        soup.indices.push_back(static_cast<uint32_t>(soup.indices.size()));
+    }
+    std::vector<Vector3> expected;
+    for (uint32_t index : soup.indices) {
+        expected.push_back(soup.vertices[index].position);
+    }
+
+    Mesh streamed = soup;
+    streamed.SetLayout(VertexLayout::Streams);
+
+    size_t removed = soup.WeldVertices();
+    size_t streamedRemoved = streamed.WeldVertices();
+    bool merged = removed == expected.size() - grid.GetVertexCount() &&
+                  soup.GetVertexCount() == grid.GetVertexCount() && streamedRemoved == removed;
+
+    bool preserved = true;
+    for (size_t i = 0; i < soup.indices.size(); ++i) {
+        preserved &= (soup.vertices[soup.indices[i]].position - expected[i]).Length() < 1e-5f;
+        preserved &= soup.vertices[soup.indices[i]].position == streamed.GetPosition(streamed.indices[i]);
+    }
+
+    Mesh seams = Mesh::CreateCube(1.0f);
+    size_t cornerDuplicates = seams.GetVertexCount() - 8;
+    size_t strict = Mesh(seams).WeldVertices(Mesh::DEFAULT_WELD_EPSILON, VertexAttribute::All);
+    size_t positional = seams.WeldVertices(Mesh::DEFAULT_WELD_EPSILON, VertexAttribute::Position);
+
+    Mesh tolerant = Mesh::CreatePlane(1.0f, 1);
+    tolerant.vertices.push_back(tolerant.vertices[0]);
+    tolerant.vertices.back().position.x += 0.02f;
+    size_t tight = Mesh(tolerant).WeldVertices(0.01f);
+    size_t loose = tolerant.WeldVertices(0.05f);
+
+    if (merged && preserved && strict == 0 && positional == cornerDuplicates && seams.GetVertexCount() == 8 &&
+        tight == 0 && loose == 1) {
+        std::cout << "Vertex welding test passed" << std::endl;
+    } else {
+        std::cout << "Vertex welding test failed" << std::endl;
+    }
+}
+
+float SurfaceArea(const Mesh& mesh) {
+    float area = 0.0f;
+    for (size_t i = 0; i + 2 < mesh.indices.size(); i += 3) {
+        Vector3 a = mesh.GetPosition(mesh.indices[i]);
+        Vector3 b = mesh.GetPosition(mesh.indices[i + 1]);
+        Vector3 c = mesh.GetPosition(mesh.indices[i + 2]);
+        area += (b - a).Cross(c - a).Length() * 0.5f;
+    }
+    return area;
+}
+
+void TestSimplification() {
+    std::cout << "Testing mesh simplification..." << std::endl;
+
+    Mesh sphere = Mesh::CreateSphere(2.0f, 48);
+    size_t sourceIndices = sphere.indices.size();
+    size_t targetIndices = sourceIndices / 4 / 3 * 3;
+    float error = sphere.Simplify(targetIndices);
+
+    float maxDeviation = 0.0f;
+    for (uint32_t index : sphere.indices) {
+        maxDeviation = std::max(maxDeviation, std::abs(sphere.GetPosition(index).Length() - 2.0f));
+    }
+    bool reduced = sphere.indices.size() <= targetIndices && sphere.indices.size() >= targetIndices * 9 / 10 &&
+                   sphere.IsValid() && maxDeviation < 1e-4f && error > 0.0f && error < 0.1f;
+
+    Mesh bounded = Mesh::CreateSphere(2.0f, 48);
+    float boundedError = bounded.Simplify(targetIndices, 0.01f);
+    bool limited = boundedError <= 0.01f && bounded.indices.size() > targetIndices &&
+                   bounded.indices.size() < sourceIndices;
+
+    Mesh plane = Mesh::CreatePlane(4.0f, 32);
+    float planeError = plane.Simplify(6);
+    bool cornersKept = true;
+    for (float x : { -2.0f, 2.0f }) {
+        for (float z : { -2.0f, 2.0f }) {
+            bool found = false;
+            for (uint32_t index : plane.indices) {
+                Vector3 p = plane.GetPosition(index);
+                found |= MathUtils::Approximately(p.x, x, 1e-5f) && MathUtils::Approximately(p.z, z, 1e-5f);
+            }
+            cornersKept &= found;
+        }
+    }
+    bool boundaryKept = cornersKept && planeError < 1e-4f && plane.GetTriangleCount() < 32 &&
+                        MathUtils::Approximately(SurfaceArea(plane), 16.0f, 1e-3f);
+
+    Mesh untouched = Mesh::CreateCube(1.0f);
+    std::vector<uint32_t> cubeIndices = untouched.indices;
+    bool noop = untouched.Simplify(cubeIndices.size()) == 0.0f && untouched.indices == cubeIndices;
+
+    if (reduced && limited && boundaryKept && noop) {
+        std::cout << "Mesh simplification test passed" << std::endl;
+    } else {
+        std::cout << "Mesh simplification test failed" << std::endl;
+    }
+}
+
+void TestLODGeneration() {
+    std::cout << "Testing LOD generation..." << std::endl;
+
+    Mesh sphere = Mesh::CreateSphere(1.0f, 40);
+    std::vector<MeshLOD> lods = sphere.GenerateLODs({ 0.25f, 1.0f, 0.5f, 0.1f });
+
+    bool ordered = lods.size() == 4 && lods[0].ratio == 1.0f && lods[0].error == 0.0f &&
+                   lods[0].mesh.GetTriangleCount() == sphere.GetTriangleCount();
+    for (size_t i = 1; i < lods.size() && ordered; ++i) {
+        ordered &= lods[i].mesh.IsValid() &&
+                   lods[i].mesh.GetTriangleCount() < lods[i - 1].mesh.GetTriangleCount() &&
+                   lods[i].ratio < lods[i - 1].ratio && lods[i].error >= lods[i - 1].error;
+    }
+
+    bool bounded = true;
+    for (const MeshLOD& lod : lods) {
+        for (uint32_t index : lod.mesh.indices) {
+            bounded &= index < lod.mesh.GetVertexCount();
+        }
+        bounded &= lod.mesh.GetVertexCount() <= sphere.GetVertexCount();
+    }
+
+    if (ordered && bounded && !lods.empty() && lods.back().ratio <= 0.1f && lods.back().error < 0.25f) {
+        std::cout << "LOD generation test passed" << std::endl;
+    } else {
+        std::cout << "LOD generation test failed" << std::endl;
+    }
+}
+
+int main() {
+    TestCacheAnalysis();
+    TestVertexCacheOptimization();
+    TestOverdrawOptimization();
+    TestVertexFetchOptimization();
+    TestVertexWelding();
+    TestSimplification();
+    TestLODGeneration();
+    return 0;
+}
@@ -0,0 +1,137 @@
+#include <algorithm>
+#include <array>
+#include <iostream>
+#include <vector>
+#include "../include/Geometry/Meshlet.h"
+#include "../include/Math3D/MathUtils.h"
+
+using namespace Geometry;
+using namespace Math3D;
+
+std::vector<std::array<uint32_t, 3>> SortedTriangles(const std::vector<uint32_t>& indices) {
+    std::vector<std::array<uint32_t, 3>> triangles;
+    for (size_t i = 0; i + 2 < indices.size(); i += 3) {
+        std::array<uint32_t, 3> triangle = { indices[i], indices[i + 1], indices[i + 2] };
+        while (triangle[0] != std::min({ triangle[0], triangle[1], triangle[2] })) {
+            std::rotate(triangle.begin(), triangle.begin() + 1, triangle.end());
+        }
+        triangles.push_back(triangle);
+    }
+    std::sort(triangles.begin(), triangles.end());
+    return triangles;
+}
+
+std::vector<uint32_t> MeshletIndices(const MeshletMesh& meshlets, const Meshlet& meshlet) {
+    std::vector<uint32_t> indices;
+    for (uint32_t k = 0; k < meshlet.triangleCount * 3; ++k) {
+        uint8_t local = meshlets.triangles[meshlet.triangleOffset * 3 + k];
+        indices.push_back(meshlets.vertices[meshlet.vertexOffset + local]);
+    }
+    return indices;
+}
+
+void TestMeshletPartition() {
+    std::cout << "Testing meshlet partition..." << std::endl;
+
+    Mesh sphere = Mesh::CreateSphere(2.0f, 48);
+    MeshletMesh meshlets = MeshletMesh::Build(sphere, 64, 96);
+
+    bool limits = !meshlets.Empty() && meshlets.GetTriangleCount() == sphere.GetTriangleCount();
+    bool bounded = true;
+    std::vector<uint32_t> gathered;
+    for (const Meshlet& meshlet : meshlets.meshlets) {
+        limits &= meshlet.vertexCount <= 64 && meshlet.triangleCount <= 96 && meshlet.triangleCount > 0;
+        for (uint32_t v = 0; v < meshlet.vertexCount; ++v) {
+            Vector3 position = sphere.GetPosition(meshlets.vertices[meshlet.vertexOffset + v]);
+            BoundingBox grown(meshlet.bounds.min - Vector3(1e-5f, 1e-5f, 1e-5f),
+                              meshlet.bounds.max + Vector3(1e-5f, 1e-5f, 1e-5f));
+            bounded &= grown.Contains(position) && (position - meshlet.center).Length() <= meshlet.radius + 1e-5f;
+        }
+        std::vector<uint32_t> indices = MeshletIndices(meshlets, meshlet);
+        gathered.insert(gathered.end(), indices.begin(), indices.end());
+    }
+    bool complete = SortedTriangles(gathered) == SortedTriangles(sphere.indices);
+
+    float averageTriangles = static_cast<float>(meshlets.GetTriangleCount()) /
+                             static_cast<float>(meshlets.GetMeshletCount());
+    bool filled = averageTriangles > 96.0f * 0.75f;
+
+    Mesh streamed = sphere;
+    streamed.SetLayout(VertexLayout::Streams);
+    MeshletMesh fromStreams = MeshletMesh::Build(streamed, 64, 96);
+    bool layoutIndependent = fromStreams.vertices == meshlets.vertices && fromStreams.triangles == meshlets.triangles;
+
+    if (limits && bounded && complete && filled && layoutIndependent && MeshletMesh::Build(Mesh()).Empty()) {
+        std::cout << "Meshlet partition test passed" << std::endl;
+    } else {
+        std::cout << "Meshlet partition test failed" << std::endl;
+    }
+}
+
+void TestNormalCones() {
+    std::cout << "Testing meshlet normal cones..." << std::endl;
+
+    Mesh sphere = Mesh::CreateSphere(2.0f, 48);
+    MeshletMesh meshlets = MeshletMesh::Build(sphere);
+
+    const Vector3 cameras[] = { Vector3(0, 0, 10), Vector3(6, 3, -4), Vector3(0, -2.5f, 0), Vector3(30, 0, 1) };
+    bool conservative = true;
+    size_t coned = 0;
+    size_t culled = 0;
+    size_t tested = 0;
+    for (const Vector3& camera : cameras) {
+        for (const Meshlet& meshlet : meshlets.meshlets) {
+            coned += meshlet.HasNormalCone() ? 1 : 0;
+            tested++;
+            if (!meshlet.IsBackFacing(camera)) {
+                continue;
+            }
+            culled++;
+            std::vector<uint32_t> indices = MeshletIndices(meshlets, meshlet);
+            for (size_t i = 0; i < indices.size(); i += 3) {
+                Vector3 p0 = sphere.GetPosition(indices[i]);
+                Vector3 p1 = sphere.GetPosition(indices[i + 1]);
+                Vector3 p2 = sphere.GetPosition(indices[i + 2]);
+                Vector3 normal = (p1 - p0).Cross(p2 - p0);
+                conservative &= normal.Dot(camera - p0) <= 1e-5f;
+            }
+        }
+    }
+
+    bool effective = coned > tested / 2 && culled > tested / 8;
+    if (conservative && effective) {
+        std::cout << "Meshlet normal cone test passed" << std::endl;
+    } else {
+        std::cout << "Meshlet normal cone test failed" << std::endl;
+    }
+}
+
+void TestMeshletCulling() {
+    std::cout << "Testing meshlet culling..." << std::endl;
+
+    Mesh sphere = Mesh::CreateSphere(2.0f, 48);
+    MeshletMesh meshlets = MeshletMesh::Build(sphere);
+
+    Matrix4 viewProjection = Matrix4::Perspective(MathUtils::Radians(20.0f), 1.0f, 0.1f, 100.0f) *
+                             Matrix4::LookAt(Vector3(0, 0, 10), Vector3(1.5f, 0, 0), Vector3::UnitY);
+    Frustum frustum(viewProjection);
+    Vector3 camera(0, 0, 10);
+
+    std::vector<uint32_t> frustumOnly, withCones;
+    size_t inFrustum = meshlets.Cull(frustum, nullptr, frustumOnly);
+    size_t visible = meshlets.Cull(frustum, &camera, withCones);
+
+    bool subset = std::includes(frustumOnly.begin(), frustumOnly.end(), withCones.begin(), withCones.end());
+    if (inFrustum < meshlets.GetMeshletCount() && visible < inFrustum && visible > 0 && subset) {
+        std::cout << "Meshlet culling test passed" << std::endl;
+    } else {
+        std::cout << "Meshlet culling test failed" << std::endl;
+    }
+}
+
+int main() {
+    TestMeshletPartition();
+    TestNormalCones();
+    TestMeshletCulling();
+    return 0;
+}
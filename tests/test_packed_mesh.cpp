@@ -0,0 +1,166 @@
+#include <cmath>
+#include <cstdint>
+#include <iostream>
+#include <limits>
+#include "../include/Geometry/PackedMesh.h"
+#include "../include/Math3D/MathUtils.h"
+#include "../include/Rendering/SoftwareRenderer.h"
+
+using namespace Geometry;
+using namespace Math3D;
+using namespace Rendering;
+
+void TestHalfConversion() {
+    std::cout << "Testing half-float conversion..." << std::endl;
+
+    bool exact = MathUtils::FloatToHalf(0.0f) == 0x0000 &&
+                 MathUtils::FloatToHalf(-0.0f) == 0x8000 &&
+                 MathUtils::FloatToHalf(1.0f) == 0x3C00 &&
+                 MathUtils::FloatToHalf(-2.0f) == 0xC000 &&
+                 MathUtils::FloatToHalf(0.5f) == 0x3800 &&
+                 MathUtils::FloatToHalf(65504.0f) == 0x7BFF &&
+                 MathUtils::FloatToHalf(std::ldexp(1.0f, -24)) == 0x0001 &&
+                 MathUtils::FloatToHalf(std::ldexp(1.0f, -14)) == 0x0400;
+
+    bool rounding = MathUtils::FloatToHalf(1.0f + std::ldexp(1.0f, -11)) == 0x3C00 &&
+                    MathUtils::FloatToHalf(1.0f + 3.0f * std::ldexp(1.0f, -11)) == 0x3C02 &&
+                    MathUtils::FloatToHalf(65520.0f) == 0x7C00 &&
+                    MathUtils::FloatToHalf(std::ldexp(1.0f, -26)) == 0x0000;
+
+    bool special = MathUtils::FloatToHalf(std::numeric_limits<float>::infinity()) == 0x7C00 &&
+                   std::isnan(MathUtils::HalfToFloat(MathUtils::FloatToHalf(std::numeric_limits<float>::quiet_NaN()))) &&
+                   std::isinf(MathUtils::HalfToFloat(0xFC00));
+
+    bool roundTrip = true;
+    for (uint32_t bits = 0; bits < 0x7C00; ++bits) {
+        uint16_t half = static_cast<uint16_t>(bits);
+        roundTrip &= MathUtils::FloatToHalf(MathUtils::HalfToFloat(half)) == half;
+        roundTrip &= MathUtils::FloatToHalf(-MathUtils::HalfToFloat(half)) == (half | 0x8000);
+    }
+
+    if (exact && rounding && special && roundTrip) {
+        std::cout << "Half conversion test passed" << std::endl;
+    } else {
+        std::cout << "Half conversion test failed" << std::endl;
+    }
+}
+
+void TestOctahedralDirections() {
+    std::cout << "Testing octahedral direction encoding..." << std::endl;
+
+    float worstDot = 1.0f;
+    for (int i = 0; i < 2000; ++i) {
+        float s = static_cast<float>(i);
+        Vector3 direction(std::sin(s * 1.3f), std::cos(s * 0.7f), std::sin(s * 2.9f + 0.4f));
+        direction.Normalize();
+        int8_t encoded[2];
+        PackedVertex::EncodeDirection(direction, encoded);
+        worstDot = std::min(worstDot, PackedVertex::DecodeDirection(encoded).Dot(direction));
+    }
+
+    bool axes = true;
+    const Vector3 axisList[] = { Vector3::UnitX, Vector3::UnitY, Vector3::UnitZ,
+                                 -Vector3::UnitX, -Vector3::UnitY, -Vector3::UnitZ };
+    for (const Vector3& axis : axisList) {
+        int8_t encoded[2];
+        PackedVertex::EncodeDirection(axis, encoded);
+        axes &= PackedVertex::DecodeDirection(encoded).Dot(axis) > 0.99999f;
+    }
+
+    if (worstDot > std::cos(MathUtils::Radians(1.0f)) && axes) {
+        std::cout << "Octahedral encoding test passed" << std::endl;
+    } else {
+        std::cout << "Octahedral encoding test failed (worst dot " << worstDot << ")" << std::endl;
+    }
+}
+
+void TestMeshRoundTrip() {
+    std::cout << "Testing PackedMesh encode/decode..." << std::endl;
+
+    Mesh source = Mesh::CreateCylinder(0.75f, 3.0f, 24);
+    source.Transform(Matrix4::Translation(Vector3(10.0f, -4.0f, 2.0f)));
+    PackedMesh packed = PackedMesh::Encode(source);
+
+    Vector3 step = packed.GetPositionStep();
+    float positionTolerance = std::max(step.x, std::max(step.y, step.z)) * 0.5f + 1e-5f;
+
+    bool positions = true, frames = true, texCoords = true;
+    for (size_t i = 0; i < source.GetVertexCount(); ++i) {
+        const Vertex& original = source.vertices[i];
+        Vertex decoded = packed.DecodeVertex(i);
+        Vector3 dequantized = (packed.GetDequantizationMatrix() *
+                               Vector4(packed.vertices[i].position[0], packed.vertices[i].position[1],
+                                       packed.vertices[i].position[2], 1.0f)).XYZ();
+
+        positions &= std::fabs(decoded.position.x - original.position.x) <= positionTolerance &&
+                     std::fabs(decoded.position.y - original.position.y) <= positionTolerance &&
+                     std::fabs(decoded.position.z - original.position.z) <= positionTolerance &&
+                     (dequantized - decoded.position).Length() < 1e-4f;
+        frames &= decoded.normal.Dot(original.normal) > 0.999f &&
+                  decoded.tangent.Dot(original.tangent) > 0.999f &&
+                  decoded.bitangent.Dot(original.bitangent) > 0.99f;
+        texCoords &= std::fabs(decoded.texCoord.x - original.texCoord.x) <= 1e-3f &&
+                     std::fabs(decoded.texCoord.y - original.texCoord.y) <= 1e-3f;
+    }
+
+    Mesh decoded = packed.Decode();
+    bool topology = decoded.indices == source.indices && decoded.GetVertexCount() == source.GetVertexCount();
+    bool compact = sizeof(PackedVertex) == 16 &&
+                   packed.GetVertexMemory() * 3 < source.GetVertexCount() * sizeof(Vertex);
+
+    if (positions && frames && texCoords && topology && compact) {
+        std::cout << "PackedMesh round trip test passed" << std::endl;
+    } else {
+        std::cout << "PackedMesh round trip test failed" << std::endl;
+    }
+}
+
+void TestPackedRendering() {
+    std::cout << "Testing packed mesh rendering..." << std::endl;
+
+    Mesh sphere = Mesh::CreateSphere(1.0f, 24);
+    PackedMesh packed = PackedMesh::Encode(sphere);
+    Matrix4 transform = Matrix4::RotationY(0.4f) * Matrix4::Scaling(Vector3(0.8f, 0.8f, 0.8f));
+
+    SoftwareRenderer reference(1);
+    SoftwareRenderer quantized(1);
+    reference.Initialize(96, 96, "Reference");
+    quantized.Initialize(96, 96, "Quantized");
+
+    reference.Clear(ClearFlags::Color | ClearFlags::Depth, Color::Black());
+    reference.DrawMesh(sphere, transform);
+    reference.EndFrame();
+
+    quantized.Clear(ClearFlags::Color | ClearFlags::Depth, Color::Black());
+    quantized.DrawPackedMesh(packed, transform);
+    quantized.EndFrame();
+
+    int covered = 0, differing = 0;
+    for (int i = 0; i < 96 * 96; ++i) {
+        uint32_t a = reference.GetColorBuffer()[i];
+        uint32_t b = quantized.GetColorBuffer()[i];
+        covered += (a & 0x00FFFFFFu) != 0 ? 1 : 0;
+        for (int shift = 0; shift < 24; shift += 8) {
+            int delta = static_cast<int>((a >> shift) & 0xFF) - static_cast<int>((b >> shift) & 0xFF);
+            if (delta > 8 || delta < -8) {
+                differing++;
+                break;
+            }
+        }
+    }
+
+    if (covered > 1000 && differing * 100 < covered && quantized.GetDrawCallCount() == 1 &&
+        quantized.GetTriangleCount() == static_cast<int>(packed.GetTriangleCount())) {
+        std::cout << "Packed rendering test passed" << std::endl;
+    } else {
+        std::cout << "Packed rendering test failed" << std::endl;
+    }
+}
+
+int main() {
+    TestHalfConversion();
+    TestOctahedralDirections();
+    TestMeshRoundTrip();
+    TestPackedRendering();
+    return 0;
+}
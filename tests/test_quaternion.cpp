@@ -0,0 +1,118 @@
+#include <cmath>
+#include <iostream>
+#include <vector>
+#include "../include/Math3D/Quaternion.h"
+#include "../include/Math3D/MathUtils.h"
+
+using namespace Math3D;
+
+bool MatricesMatch(const Matrix4& a, const Matrix4& b) {
+    for (int row = 0; row < 4; ++row) {
+        for (int col = 0; col < 4; ++col) {
+            if (!MathUtils::Approximately(a(row, col), b(row, col), 1e-5f)) {
+                return false;
+            }
+        }
+    }
+    return true;
+}
+
+bool VectorsMatch(const Vector3& a, const Vector3& b) {
+    return MathUtils::Approximately(a.x, b.x, 1e-4f) &&
+           MathUtils::Approximately(a.y, b.y, 1e-4f) &&
+           MathUtils::Approximately(a.z, b.z, 1e-4f);
+}
+
+bool QuaternionsMatch(const Quaternion& a, const Quaternion& b, float epsilon) {
+    return MathUtils::Approximately(a.x, b.x, epsilon) &&
+           MathUtils::Approximately(a.y, b.y, epsilon) &&
+           MathUtils::Approximately(a.z, b.z, epsilon) &&
+           MathUtils::Approximately(a.w, b.w, epsilon);
+}
+
+void TestConversion() {
+    std::cout << "Testing Quaternion conversion..." << std::endl;
+
+    bool axes = MatricesMatch(Quaternion::FromAxisAngle(Vector3::UnitX, 0.8f).ToMatrix4(), Matrix4::RotationX(0.8f)) &&
+                MatricesMatch(Quaternion::FromAxisAngle(Vector3::UnitY, -1.1f).ToMatrix4(), Matrix4::RotationY(-1.1f)) &&
+                MatricesMatch(Quaternion::FromAxisAngle(Vector3::UnitZ, 2.3f).ToMatrix4(), Matrix4::RotationZ(2.3f));
+
+    Matrix4 chained = Matrix4::RotationY(0.4f) * Matrix4::RotationX(-0.7f) * Matrix4::RotationZ(1.2f);
+    bool euler = MatricesMatch(Quaternion::FromEuler(-0.7f, 0.4f, 1.2f).ToMatrix4(), chained);
+
+    if (axes && euler) {
+        std::cout << "Quaternion to matrix test passed" << std::endl;
+    } else {
+        std::cout << "Quaternion to matrix test failed" << std::endl;
+    }
+}
+
+void TestComposition() {
+    std::cout << "Testing Quaternion composition..." << std::endl;
+
+    Quaternion a = Quaternion::FromAxisAngle(Vector3(1.0f, 2.0f, -0.5f), 0.9f);
+    Quaternion b = Quaternion::FromEuler(0.3f, -1.4f, 0.6f);
+    Vector3 v(0.5f, -2.0f, 3.0f);
+
+    bool compose = VectorsMatch((a * b).Rotate(v), a.Rotate(b.Rotate(v)));
+    bool matrix = VectorsMatch(a.Rotate(v), (a.ToMatrix4() * Vector4(v, 1.0f)).XYZ()) &&
+                  VectorsMatch(a.Rotate(v), a.ToMatrix3() * v);
+    bool inverse = QuaternionsMatch((a * b.Inverse()) * b, a, 1e-5f) &&
+                   QuaternionsMatch(a * a.Conjugate(), Quaternion::Identity(), 1e-5f);
+
+    if (compose && matrix && inverse) {
+        std::cout << "Quaternion composition test passed" << std::endl;
+    } else {
+        std::cout << "Quaternion composition test failed" << std::endl;
+    }
+}
+
+void TestInterpolation() {
+    std::cout << "Testing Quaternion interpolation..." << std::endl;
+
+    Quaternion from = Quaternion::FromAxisAngle(Vector3::UnitY, 0.0f);
+    Quaternion to = Quaternion::FromAxisAngle(Vector3::UnitY, 2.0f);
+    Quaternion half = Quaternion::Slerp(from, to, 0.5f);
+    bool midpoint = QuaternionsMatch(half, Quaternion::FromAxisAngle(Vector3::UnitY, 1.0f), 1e-6f);
+    bool shortest = QuaternionsMatch(Quaternion::Slerp(from, -to, 0.5f), half, 1e-6f);
+
+    if (midpoint && shortest) {
+        std::cout << "Slerp test passed" << std::endl;
+    } else {
+        std::cout << "Slerp test failed" << std::endl;
+    }
+
+    const size_t count = 45;
+    std::vector<Quaternion> starts(count), ends(count), slerped(count), nlerped(count);
+    std::vector<float> weights(count);
+    for (size_t i = 0; i < count; ++i) {
+        float s = static_cast<float>(i);
+        starts[i] = Quaternion::FromEuler(std::sin(s) * 2.0f, s * 0.37f, std::cos(s * 0.5f));
+        ends[i] = Quaternion::FromEuler(s * -0.21f, std::cos(s) * 3.0f, 0.4f);
+        weights[i] = std::fmod(s * 0.173f, 1.0f);
+    }
+    ends[3] = starts[3];
+    ends[4] = -starts[4];
+
+    Quaternion::SlerpBatch(starts.data(), ends.data(), weights.data(), slerped.data(), count);
+    Quaternion::NlerpBatch(starts.data(), ends.data(), weights.data(), nlerped.data(), count);
+
+    bool batchSlerp = true, batchNlerp = true;
+    for (size_t i = 0; i < count; ++i) {
+        batchSlerp &= QuaternionsMatch(slerped[i], Quaternion::Slerp(starts[i], ends[i], weights[i]), 2e-6f);
+        batchNlerp &= QuaternionsMatch(nlerped[i], Quaternion::Nlerp(starts[i], ends[i], weights[i]), 1e-6f);
+    }
+
+    if (batchSlerp && batchNlerp) {
+        std::cout << "Batch interpolation test passed" << std::endl;
+    } else {
+        std::cout << "Batch interpolation test failed" << std::endl;
+    }
+}
+
+int main() {
+    TestConversion();
+    TestComposition();
+    TestInterpolation();
+    return 0;
+}
@@ -2,6 +2,7 @@
 #include "../include/Rendering/IRenderer.h"
 #include "../include/Rendering/NullRenderer.h"
 #include "../include/Geometry/Mesh.h"  
+#include "../include/Geometry/LODGroup.h"
 
 using namespace Rendering;
 using namespace Geometry;
@@ -52,7 +53,46 @@ void TestRendererInterface() {
     }
 }
 
+class MinimalRenderer : public IRenderer {
+public:
+    size_t lastTriangleCount = 0;
+
+    bool Initialize(int, int, const char*) override { return true; }
+    void Shutdown() override {}
+    void Resize(int, int) override {}
+    void BeginFrame() override {}
+    void EndFrame() override {}
+    void Clear(ClearFlags, const Color&) override {}
+    void SetRenderState(RenderState) override {}
+    void EnableState(RenderState) override {}
+    void DisableState(RenderState) override {}
+    void SetViewport(int, int, int, int) override {}
+    void SetProjectionMatrix(const Math3D::Matrix4&) override {}
+    void SetViewMatrix(const Math3D::Matrix4&) override {}
+    void DrawMesh(const Mesh& mesh, const Math3D::Matrix4&) override { lastTriangleCount = mesh.GetTriangleCount(); }
+    void DrawMesh(const Mesh& mesh) override { lastTriangleCount = mesh.GetTriangleCount(); }
+    const char* GetName() const override { return "MinimalRenderer"; }
+    int GetWidth() const override { return 800; }
+    int GetHeight() const override { return 600; }
+};
+
+void TestDefaultLODGroup() {
+    std::cout << "Testing default LOD group drawing..." << std::endl;
+
+    Mesh sphere = Mesh::CreateSphere(1.0f, 24);
+    LODGroup group = LODGroup::Create(sphere, { 0.5f, 0.1f });
+    MinimalRenderer renderer;
+    renderer.DrawLODGroup(group, Math3D::Matrix4::Translation(Math3D::Vector3(0, 0, -500)));
+
+    if (group.GetLevelCount() > 1 && renderer.lastTriangleCount == sphere.GetTriangleCount()) {
+        std::cout << "Default LOD group test passed" << std::endl;
+    } else {
+        std::cout << "Default LOD group test failed" << std::endl;
+    }
+}
+
 int main() {
     TestRendererInterface();
+    TestDefaultLODGroup();
     return 0;
 }
@@ -0,0 +1,279 @@
+#include <iostream>
+#include <utility>
+#include "../include/Rendering/SoftwareRenderer.h"
+#include "../include/Geometry/LODGroup.h"
+#include "../include/Geometry/Mesh.h"
+#include "../include/Geometry/Meshlet.h"
+#include "../include/Math3D/MathUtils.h"
+
+using namespace Rendering;
+using namespace Geometry;
+using namespace Math3D;
+
+int CountPixels(const SoftwareRenderer& renderer, uint32_t background) {
+    int count = 0;
+    const uint32_t* pixels = renderer.GetColorBuffer();
+    for (int i = 0; i < renderer.GetWidth() * renderer.GetHeight(); ++i) {
+        if (pixels[i] != background) {
+            count++;
+        }
+    }
+    return count;
+}
+
+void TestClearAndDraw() {
+    std::cout << "Testing Software Renderer Clear and Draw..." << std::endl;
+
+    SoftwareRenderer renderer;
+    renderer.Initialize(200, 150, "TestSoftwareRenderer");
+    renderer.Clear(ClearFlags::Color | ClearFlags::Depth, Color::Blue());
+
+    uint32_t background = SoftwareRenderer::PackColor(Color::Blue());
+    if (CountPixels(renderer, background) == 0) {
+        std::cout << "Clear test passed" << std::endl;
+    } else {
+        std::cout << "Clear test failed" << std::endl;
+    }
+
+    Mesh cube = Mesh::CreateCube(1.0f);
+    renderer.BeginFrame();
+    renderer.DrawMesh(cube, Matrix4::RotationY(0.5f) * Matrix4::RotationX(0.3f));
+    renderer.EndFrame();
+
+    size_t center = 75 * 200 + 100;
+    if (renderer.GetColorBuffer()[center] != background && renderer.GetDepthBuffer()[center] < 1.0f &&
+        renderer.GetColorBuffer()[0] == background) {
+        std::cout << "Cube rasterization test passed" << std::endl;
+    } else {
+        std::cout << "Cube rasterization test failed" << std::endl;
+    }
+
+    if (renderer.GetDrawCallCount() == 1 && renderer.GetTriangleCount() == 12) {
+        std::cout << "Statistics test passed" << std::endl;
+    } else {
+        std::cout << "Statistics test failed" << std::endl;
+    }
+}
+
+void TestPerspectiveCamera() {
+    std::cout << "Testing Software Renderer Camera..." << std::endl;
+
+    SoftwareRenderer renderer;
+    renderer.Initialize(160, 120, "TestSoftwareRenderer");
+    renderer.SetProjectionMatrix(Matrix4::Perspective(MathUtils::Radians(60.0f), 160.0f / 120.0f, 0.1f, 100.0f));
+    renderer.SetViewMatrix(Matrix4::LookAt(Vector3(0, 0, 5), Vector3::Zero, Vector3::UnitY));
+    renderer.Clear(ClearFlags::Color | ClearFlags::Depth);
+
+    Mesh sphere = Mesh::CreateSphere(1.0f, 16);
+    renderer.DrawMesh(sphere);
+    renderer.Flush();
+
+    uint32_t background = SoftwareRenderer::PackColor(Color::Black());
+    size_t center = 60 * 160 + 80;
+    if (renderer.GetColorBuffer()[center] != background && renderer.GetColorBuffer()[0] == background) {
+        std::cout << "Perspective view test passed" << std::endl;
+    } else {
+        std::cout << "Perspective view test failed" << std::endl;
+    }
+
+    renderer.Clear(ClearFlags::Color | ClearFlags::Depth);
+    renderer.DrawMesh(sphere, Matrix4::Translation(Vector3(0, 0, 10)));
+    renderer.Flush();
+    if (CountPixels(renderer, background) == 0) {
+        std::cout << "Behind camera clipping test passed" << std::endl;
+    } else {
+        std::cout << "Behind camera clipping test failed" << std::endl;
+    }
+
+    renderer.ResetStatistics();
+    renderer.DrawMesh(sphere, Matrix4::Translation(Vector3(40, 0, 0)));
+    renderer.DrawMesh(sphere, Matrix4::Translation(Vector3(1.5f, 0, 0)));
+    if (renderer.GetCulledMeshCount() == 1 && renderer.GetDrawCallCount() == 1) {
+        std::cout << "Frustum culling test passed" << std::endl;
+    } else {
+        std::cout << "Frustum culling test failed" << std::endl;
+    }
+    renderer.Flush();
+}
+
+void TestRenderStates() {
+    std::cout << "Testing Software Renderer States..." << std::endl;
+
+    SoftwareRenderer renderer;
+    renderer.Initialize(128, 128, "TestSoftwareRenderer");
+    uint32_t background = SoftwareRenderer::PackColor(Color::Black());
+    Mesh sphere = Mesh::CreateSphere(0.8f, 24);
+
+    renderer.Clear(ClearFlags::Color | ClearFlags::Depth);
+    renderer.DrawMesh(sphere);
+    renderer.Flush();
+    int filled = CountPixels(renderer, background);
+
+    renderer.EnableState(RenderState::Wireframe);
+    renderer.Clear(ClearFlags::Color | ClearFlags::Depth);
+    renderer.DrawMesh(sphere);
+    renderer.Flush();
+    int wireframe = CountPixels(renderer, background);
+    renderer.DisableState(RenderState::Wireframe);
+
+    if (wireframe > 0 && wireframe < filled) {
+        std::cout << "Wireframe state test passed" << std::endl;
+    } else {
+        std::cout << "Wireframe state test failed" << std::endl;
+    }
+
+    std::vector<Vertex> vertices = {
+        Vertex(Vector3(-0.5f, -0.5f, 0.0f)),
+        Vertex(Vector3(-0.5f, 0.5f, 0.0f)),
+        Vertex(Vector3(0.5f, -0.5f, 0.0f))
+    };
+    Mesh backFacing(vertices, {0, 1, 2});
+
+    renderer.EnableState(RenderState::FaceCulling);
+    renderer.Clear(ClearFlags::Color | ClearFlags::Depth);
+    renderer.DrawMesh(backFacing);
+    renderer.Flush();
+    int culled = CountPixels(renderer, background);
+
+    renderer.DisableState(RenderState::FaceCulling);
+    renderer.DrawMesh(backFacing);
+    renderer.Flush();
+    int unculled = CountPixels(renderer, background);
+
+    if (culled == 0 && unculled > 0) {
+        std::cout << "Face culling state test passed" << std::endl;
+    } else {
+        std::cout << "Face culling state test failed" << std::endl;
+    }
+}
+
+void TestThreadedDeterminism() {
+    std::cout << "Testing Software Renderer Threading..." << std::endl;
+
+    SoftwareRenderer serial(1);
+    SoftwareRenderer threaded(4);
+    serial.Initialize(300, 200, "Serial");
+    threaded.Initialize(300, 200, "Threaded");
+
+    Mesh sphere = Mesh::CreateSphere(0.9f, 48);
+    Matrix4 transform = Matrix4::RotationY(0.7f) * Matrix4::Scaling(Vector3(1.0f, 0.8f, 1.0f));
+
+    SoftwareRenderer* renderers[] = { &serial, &threaded };
+    for (SoftwareRenderer* renderer : renderers) {
+        renderer->Clear(ClearFlags::Color | ClearFlags::Depth);
+        renderer->DrawMesh(sphere, transform);
+        renderer->DrawMesh(sphere, Matrix4::Translation(Vector3(0.5f, 0.0f, 0.2f)));
+        renderer->EndFrame();
+    }
+
+    bool identical = true;
+    for (int i = 0; i < 300 * 200; ++i) {
+        if (serial.GetColorBuffer()[i] != threaded.GetColorBuffer()[i]) {
+            identical = false;
+            break;
+        }
+    }
+
+    if (identical) {
+        std::cout << "Threaded determinism test passed" << std::endl;
+    } else {
+        std::cout << "Threaded determinism test failed" << std::endl;
+    }
+}
+
+void TestLODSelection() {
+    std::cout << "Testing Software Renderer LOD Selection..." << std::endl;
+
+    SoftwareRenderer renderer;
+    renderer.Initialize(160, 120, "TestSoftwareRenderer");
+    renderer.SetProjectionMatrix(Matrix4::Perspective(MathUtils::Radians(60.0f), 160.0f / 120.0f, 0.1f, 500.0f));
+    renderer.SetViewMatrix(Matrix4::LookAt(Vector3(0, 0, 5), Vector3::Zero, Vector3::UnitY));
+
+    Mesh sphere = Mesh::CreateSphere(1.0f, 32);
+    LODGroup group = LODGroup::Create(sphere, { 0.5f, 0.1f });
+    group.SetErrorThreshold(0.1f);
+    const int fullTriangles = static_cast<int>(sphere.GetTriangleCount());
+    const int coarseTriangles = static_cast<int>(group.GetLevel(2).mesh.GetTriangleCount());
+
+    renderer.ResetStatistics();
+    renderer.DrawLODGroup(group, Matrix4::Identity());
+    bool near = group.GetCurrentLevel() == 0 && renderer.GetTriangleCount() == fullTriangles &&
+                renderer.GetLODTrianglesSaved() == 0;
+
+    renderer.ResetStatistics();
+    renderer.DrawLODGroup(group, Matrix4::Translation(Vector3(0, 0, -300)));
+    bool far = group.GetCurrentLevel() == 2 && renderer.GetTriangleCount() == coarseTriangles &&
+               renderer.GetLODTrianglesSaved() == fullTriangles - coarseTriangles;
+
+    renderer.ResetStatistics();
+    renderer.DrawLODGroup(group, Matrix4::Translation(Vector3(400, 0, -300)));
+    bool culled = renderer.GetCulledMeshCount() == 1 && renderer.GetLODTrianglesSaved() == 0;
+    renderer.Flush();
+
+    if (near && far && culled) {
+        std::cout << "LOD selection test passed" << std::endl;
+    } else {
+        std::cout << "LOD selection test failed" << std::endl;
+    }
+}
+
+Mesh CreateCounterClockwiseSphere(float radius, uint32_t segments) {
+    Mesh sphere = Mesh::CreateSphere(radius, segments);
+    for (size_t i = 0; i + 2 < sphere.indices.size(); i += 3) {
+        std::swap(sphere.indices[i + 1], sphere.indices[i + 2]);
+    }
+    return sphere;
+}
+
+void TestMeshletRendering() {
+    std::cout << "Testing Software Renderer Meshlet Culling..." << std::endl;
+
+    SoftwareRenderer reference;
+    SoftwareRenderer clustered;
+    for (SoftwareRenderer* renderer : { &reference, &clustered }) {
+        renderer->Initialize(160, 120, "TestSoftwareRenderer");
+        renderer->SetProjectionMatrix(Matrix4::Perspective(MathUtils::Radians(45.0f), 160.0f / 120.0f, 0.1f, 100.0f));
+        renderer->SetViewMatrix(Matrix4::LookAt(Vector3(1, 2, 6), Vector3(1.5f, 0, 0), Vector3::UnitY));
+        renderer->SetRenderState(RenderState::DepthTest | RenderState::FaceCulling);
+        renderer->Clear(ClearFlags::Color | ClearFlags::Depth);
+    }
+
+    Mesh sphere = CreateCounterClockwiseSphere(2.0f, 48);
+    MeshletMesh meshlets = MeshletMesh::Build(sphere);
+    Matrix4 transform = Matrix4::RotationY(0.4f) * Matrix4::Scaling(Vector3(1.0f, 1.2f, 1.0f));
+    reference.DrawMesh(sphere, transform);
+    clustered.DrawMeshlets(sphere, meshlets, transform);
+    reference.Flush();
+    clustered.Flush();
+
+    bool identical = true;
+    for (int i = 0; i < 160 * 120; ++i) {
+        identical &= reference.GetColorBuffer()[i] == clustered.GetColorBuffer()[i];
+    }
+    uint32_t background = SoftwareRenderer::PackColor(Color::Black());
+    bool culled = clustered.GetCulledClusterCount() > static_cast<int>(meshlets.GetMeshletCount() / 3) &&
+                  clustered.GetTriangleCount() < reference.GetTriangleCount() && clustered.GetDrawCallCount() == 1 &&
+                  CountPixels(clustered, background) > 0;
+
+    clustered.ResetStatistics();
+    clustered.DisableState(RenderState::FaceCulling);
+    clustered.DrawMeshlets(sphere, meshlets, Matrix4::Translation(Vector3(0, 50, 0)));
+    bool offscreen = clustered.GetCulledMeshCount() == 1 && clustered.GetTriangleCount() == 0;
+    clustered.Flush();
+
+    if (identical && culled && offscreen) {
+        std::cout << "Meshlet culling test passed" << std::endl;
+    } else {
+        std::cout << "Meshlet culling test failed" << std::endl;
+    }
+}
+
+int main() {
+    TestClearAndDraw();
+    TestPerspectiveCamera();
+    TestRenderStates();
+    TestThreadedDeterminism();
+    TestLODSelection();
+    TestMeshletRendering();
+    return 0;
+}
@@ -0,0 +1,159 @@
+#include <iostream>
+#include <cstdio>
+#include <string>
+#include "../include/Rendering/TerminalRenderer.h"
+#include "../include/Geometry/Mesh.h"
+
+using namespace Rendering;
+using namespace Geometry;
+using namespace Math3D;
+
+void TestTerminalOutput() {
+    std::cout << "Testing Terminal Renderer..." << std::endl;
+
+    FILE* output = std::tmpfile();
+    TerminalRenderer renderer(fileno(output));
+
+    if (renderer.Initialize(40, 12, "TestTerminalRenderer") &&
+        renderer.GetWidth() == 40 && renderer.GetHeight() == 24) {
+        std::cout << "Half-block resolution test passed" << std::endl;
+    } else {
+        std::cout << "Half-block resolution test failed" << std::endl;
+    }
+
+    renderer.BeginFrame();
+    renderer.Clear(ClearFlags::Color | ClearFlags::Depth, Color(0.0f, 0.0f, 1.0f));
+    renderer.DrawMesh(Mesh::CreateSphere(0.6f, 12));
+    renderer.EndFrame();
+
+    std::string frame(renderer.GetFrameData(), renderer.GetFrameSize());
+    if (frame.find("\xE2\x96\x80") != std::string::npos &&
+        frame.find("\x1b[48;2;0;0;255m") != std::string::npos &&
+        frame.compare(0, 10, "\x1b[2J\x1b[1;1H") == 0) {
+        std::cout << "Truecolor encoding test passed" << std::endl;
+    } else {
+        std::cout << "Truecolor encoding test failed" << std::endl;
+    }
+
+    std::fseek(output, 0, SEEK_END);
+    long written = std::ftell(output);
+    if (written > static_cast<long>(renderer.GetFrameSize())) {
+        std::cout << "Frame write test passed" << std::endl;
+    } else {
+        std::cout << "Frame write test failed" << std::endl;
+    }
+
+    renderer.ResetStatistics();
+    renderer.BeginFrame();
+    renderer.Clear(ClearFlags::Color | ClearFlags::Depth, Color(0.0f, 0.0f, 1.0f));
+    renderer.DrawMesh(Mesh::CreateSphere(0.6f, 12));
+    renderer.EndFrame();
+
+    if (renderer.GetFrameSize() == 0 && renderer.GetBytesWritten() == 0) {
+        std::cout << "Unchanged frame delta test passed" << std::endl;
+    } else {
+        std::cout << "Unchanged frame delta test failed" << std::endl;
+    }
+
+    renderer.BeginFrame();
+    renderer.Clear(ClearFlags::Color | ClearFlags::Depth, Color(0.0f, 0.0f, 1.0f));
+    renderer.DrawMesh(Mesh::CreateSphere(0.6f, 12), Matrix4::Translation(Vector3(0.1f, 0.0f, 0.0f)));
+    renderer.EndFrame();
+
+    int deltaBytes = renderer.GetBytesWritten();
+    renderer.Invalidate();
+    renderer.EndFrame();
+    int fullBytes = renderer.GetBytesWritten() - deltaBytes;
+
+    if (deltaBytes > 0 && deltaBytes < fullBytes) {
+        std::cout << "Changed frame delta test passed" << std::endl;
+    } else {
+        std::cout << "Changed frame delta test failed" << std::endl;
+    }
+
+    renderer.Clear(ClearFlags::Color, Color(0.0f, 0.0f, 1.0f));
+    renderer.Invalidate();
+    renderer.EndFrame();
+    if (renderer.GetFrameSize() < static_cast<size_t>(40 * 12 * 3 + 12 * 8 + 64)) {
+        std::cout << "Redundant color skipping test passed" << std::endl;
+    } else {
+        std::cout << "Redundant color skipping test failed" << std::endl;
+    }
+
+    renderer.Resize(20, 6);
+    if (renderer.GetColumns() == 20 && renderer.GetRows() == 6 && renderer.GetHeight() == 12) {
+        std::cout << "Terminal resize test passed" << std::endl;
+    } else {
+        std::cout << "Terminal resize test failed" << std::endl;
+    }
+
+    renderer.Shutdown();
+    std::fclose(output);
+}
+
+void TestBrailleOutput() {
+    std::cout << "Testing Terminal Braille Mode..." << std::endl;
+
+    FILE* output = std::tmpfile();
+    TerminalRenderer renderer(fileno(output));
+    renderer.SetOutputMode(TerminalOutputMode::Braille);
+
+    if (renderer.Initialize(30, 10, "TestTerminalBraille") &&
+        renderer.GetWidth() == 60 && renderer.GetHeight() == 40) {
+        std::cout << "Braille resolution test passed" << std::endl;
+    } else {
+        std::cout << "Braille resolution test failed" << std::endl;
+    }
+
+    std::vector<Vertex> vertices = {
+        Vertex(Vector3(-1.0f, -1.0f, 0.0f)),
+        Vertex(Vector3(1.0f, -1.0f, 0.0f)),
+        Vertex(Vector3(1.0f, 1.0f, 0.0f)),
+        Vertex(Vector3(-1.0f, 1.0f, 0.0f))
+    };
+    Mesh quad(vertices, {0, 1, 2, 2, 3, 0});
+
+    renderer.SetLightDirection(Vector3(0.0f, 0.0f, -1.0f));
+    renderer.Clear(ClearFlags::Color | ClearFlags::Depth);
+    renderer.DrawMesh(quad);
+    renderer.EndFrame();
+
+    std::string frame(renderer.GetFrameData(), renderer.GetFrameSize());
+    size_t fullCells = 0;
+    for (size_t pos = frame.find("\xE2\xA3\xBF"); pos != std::string::npos; pos = frame.find("\xE2\xA3\xBF", pos + 3)) {
+        fullCells++;
+    }
+    if (fullCells == 30 * 10) {
+        std::cout << "Braille coverage packing test passed" << std::endl;
+    } else {
+        std::cout << "Braille coverage packing test failed: " << fullCells << std::endl;
+    }
+
+    renderer.EnableState(RenderState::Wireframe);
+    renderer.Clear(ClearFlags::Color | ClearFlags::Depth);
+    renderer.DrawMesh(Mesh::CreateSphere(0.8f, 8));
+    renderer.EndFrame();
+
+    frame.assign(renderer.GetFrameData(), renderer.GetFrameSize());
+    if (frame.find("\xE2\xA0") != std::string::npos && frame.find(' ') != std::string::npos) {
+        std::cout << "Braille wireframe test passed" << std::endl;
+    } else {
+        std::cout << "Braille wireframe test failed" << std::endl;
+    }
+
+    renderer.SetOutputMode(TerminalOutputMode::HalfBlock);
+    if (renderer.GetColumns() == 30 && renderer.GetHeight() == 20) {
+        std::cout << "Output mode switch test passed" << std::endl;
+    } else {
+        std::cout << "Output mode switch test failed" << std::endl;
+    }
+
+    renderer.Shutdown();
+    std::fclose(output);
+}
+
+int main() {
+    TestTerminalOutput();
+    TestBrailleOutput();
+    return 0;
+}
@@ -0,0 +1,152 @@
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <iostream>
+#include <vector>
+#include "../include/Math3D/Vector3Stream.h"
+#include "../include/Math3D/MathUtils.h"
+#include "../include/Math3D/Matrix4.h"
+#include "../include/Math3D/SIMD.h"
+
+using namespace Math3D;
+
+bool Matches(const Vector3& a, const Vector3& b) {
+    return MathUtils::Approximately(a.x, b.x, 1e-5f) &&
+           MathUtils::Approximately(a.y, b.y, 1e-5f) &&
+           MathUtils::Approximately(a.z, b.z, 1e-5f);
+}
+
+std::vector<Vector3> MakePoints(size_t count, float phase) {
+    std::vector<Vector3> points(count);
+    for (size_t i = 0; i < count; ++i) {
+        float t = static_cast<float>(i) + phase;
+        points[i] = Vector3(std::sin(t) * 4.0f, std::cos(t * 1.3f) * 2.0f, t * 0.25f - 3.0f);
+    }
+    return points;
+}
+
+void TestStreamStorage() {
+    std::cout << "Testing Vector3Stream storage..." << std::endl;
+
+    std::vector<Vector3> points = MakePoints(29, 0.0f);
+    Vector3Stream stream(points.data(), points.size());
+
+    bool aligned = reinterpret_cast<uintptr_t>(stream.X()) % Vector3Stream::ALIGNMENT == 0 &&
+                   reinterpret_cast<uintptr_t>(stream.Y()) % Vector3Stream::ALIGNMENT == 0 &&
+                   reinterpret_cast<uintptr_t>(stream.Z()) % Vector3Stream::ALIGNMENT == 0;
+
+    std::vector<Vector3> roundTrip(points.size());
+    stream.CopyTo(roundTrip.data());
+
+    if (aligned && stream.Size() == points.size() && roundTrip == points && stream.Get(7) == points[7]) {
+        std::cout << "Stream storage test passed" << std::endl;
+    } else {
+        std::cout << "Stream storage test failed" << std::endl;
+    }
+}
+
+void TestStreamKernels() {
+    std::cout << "Testing Vector3Stream kernels (" << SIMD::GetLevelName(SIMD::GetLevel()) << ")..." << std::endl;
+
+    const size_t count = 37;
+    std::vector<Vector3> a = MakePoints(count, 0.0f);
+    std::vector<Vector3> b = MakePoints(count, 2.5f);
+    a[5] = Vector3::Zero;
+
+    Vector3Stream streamA(a.data(), count);
+    Vector3Stream streamB(b.data(), count);
+
+    Vector3Stream sum, difference, scaled, cross;
+    Vector3Stream::Add(streamA, streamB, sum);
+    Vector3Stream::Subtract(streamA, streamB, difference);
+    Vector3Stream::Scale(streamA, -1.5f, scaled);
+    Vector3Stream::Cross(streamA, streamB, cross);
+
+    std::vector<float> dots(count), lengths(count);
+    Vector3Stream::Dot(streamA, streamB, dots.data());
+    streamA.Lengths(lengths.data());
+
+    Vector3Stream normalized = streamA;
+    normalized.Normalize();
+
+    bool arithmetic = true, products = true, normals = true;
+    for (size_t i = 0; i < count; ++i) {
+        arithmetic &= Matches(sum.Get(i), a[i] + b[i]);
+        arithmetic &= Matches(difference.Get(i), a[i] - b[i]);
+        arithmetic &= Matches(scaled.Get(i), a[i] * -1.5f);
+        products &= Matches(cross.Get(i), a[i].Cross(b[i]));
+        products &= MathUtils::Approximately(dots[i], a[i].Dot(b[i]), 1e-4f);
+        products &= MathUtils::Approximately(lengths[i], a[i].Length(), 1e-5f);
+        normals &= Matches(normalized.Get(i), a[i].Normalized());
+    }
+
+    if (arithmetic) {
+        std::cout << "Stream arithmetic test passed" << std::endl;
+    } else {
+        std::cout << "Stream arithmetic test failed" << std::endl;
+    }
+
+    if (products) {
+        std::cout << "Stream dot/cross/length test passed" << std::endl;
+    } else {
+        std::cout << "Stream dot/cross/length test failed" << std::endl;
+    }
+
+    if (normals) {
+        std::cout << "Stream normalize test passed" << std::endl;
+    } else {
+        std::cout << "Stream normalize test failed" << std::endl;
+    }
+
+    Vector3 expectedMin = a[0], expectedMax = a[0];
+    for (const Vector3& point : a) {
+        expectedMin = Vector3(std::min(expectedMin.x, point.x), std::min(expectedMin.y, point.y), std::min(expectedMin.z, point.z));
+        expectedMax = Vector3(std::max(expectedMax.x, point.x), std::max(expectedMax.y, point.y), std::max(expectedMax.z, point.z));
+    }
+
+    Vector3 min, max;
+    Vector3 emptyMin, emptyMax;
+    bool found = streamA.MinMax(min, max);
+    bool emptyFound = Vector3Stream().MinMax(emptyMin, emptyMax);
+
+    if (found && !emptyFound && min == expectedMin && max == expectedMax) {
+        std::cout << "Stream min/max test passed" << std::endl;
+    } else {
+        std::cout << "Stream min/max test failed" << std::endl;
+    }
+}
+
+void TestStreamTransforms() {
+    std::cout << "Testing Vector3Stream transforms (" << SIMD::GetLevelName(SIMD::GetLevel()) << ")..." << std::endl;
+
+    const size_t count = 45;
+    std::vector<Vector3> points = MakePoints(count, 1.0f);
+    Matrix4 matrix = Matrix4::Translation(Vector3(2.0f, -1.0f, 4.0f)) *
+                     Matrix4::RotationX(0.4f) *
+                     Matrix4::Scaling(Vector3(1.5f, 0.5f, 3.0f));
+    Matrix3 linear = matrix.NormalMatrix();
+
+    Vector3Stream transformedPoints(points.data(), count);
+    Vector3Stream transformedDirections(points.data(), count);
+    transformedPoints.TransformPoints(matrix);
+    transformedDirections.TransformDirections(linear);
+
+    bool matches = true;
+    for (size_t i = 0; i < count; ++i) {
+        matches &= Matches(transformedPoints.Get(i), (matrix * Vector4(points[i], 1.0f)).XYZ());
+        matches &= Matches(transformedDirections.Get(i), linear * points[i]);
+    }
+
+    if (matches) {
+        std::cout << "Stream transform test passed" << std::endl;
+    } else {
+        std::cout << "Stream transform test failed" << std::endl;
+    }
+}
+
+int main() {
+    TestStreamStorage();
+    TestStreamKernels();
+    TestStreamTransforms();
+    return 0;
+}